@@ -0,0 +1,271 @@
+from contextlib import redirect_stdout
+import io
+import json
+import math
+import pickle
+import random
+import time
+from pathlib import Path
+from typing import Any, Dict, List, Tuple, Union
+
+from fire import Fire
+import numpy as np
+from tabulate import tabulate
+
+import vamp
+
+# Search space of each tunable setting, by its keyword in `configure_robot_and_planner_with_kwargs`: a
+# (low, high) pair of floats is sampled log-uniformly, a pair of ints log-uniformly and rounded, and a list is
+# sampled from uniformly.
+RRTC_SPACE = {
+    "range": (0.25, 4.0),
+    "dynamic_domain": [True, False],
+    "radius": (1.0, 8.0),
+    "alpha": (1e-5, 1e-2),
+    "min_radius": (0.25, 2.0),
+    "balance": [True, False],
+    "tree_ratio": (0.25, 4.0),
+    "start_tree_first": [True, False],
+    }
+
+SEARCH_SPACES = {
+    "rrtc": RRTC_SPACE,
+    "prm": {
+        "neighbor_gamma_scale": (0.5, 4.0),
+        },
+    "fcit": {
+        "batch_size": (100, 5000),
+        "neighbor_gamma_scale": (0.5, 4.0),
+        },
+    "aorrtc": {
+        **{f"rrtc_{k}": v for k, v in RRTC_SPACE.items()},
+        "cost_bound_resample": [True, False],
+        "use_phs": [True, False],
+        "simplify_intermediate": [True, False],
+        "max_internal_iterations": (1000, 100000),
+        },
+    }
+
+SIMPLIFY_SPACE = {
+    "simplification_max_iterations": (1, 20),
+    "simplification_operations": [
+        ["SHORTCUT", "BSPLINE"],
+        ["REDUCE", "SHORTCUT", "BSPLINE"],
+        ["SHORTCUT", "REDUCE", "BSPLINE"],
+        ["REDUCE", "SHORTCUT"],
+        ["SHORTCUT"],
+        ],
+    "reduce_max_steps": (1, 50),
+    "reduce_max_empty_steps": (1, 20),
+    "reduce_range_ratio": (0.1, 1.0),
+    "bspline_max_steps": (1, 10),
+    "bspline_min_change": (0.01, 0.5),
+    }
+
+
+def sample_value(space: Union[Tuple, List], rng: random.Random) -> Any:
+    if isinstance(space, list):
+        return rng.choice(space)
+
+    low, high = space
+    value = math.exp(rng.uniform(math.log(low), math.log(high)))
+    if isinstance(low, int):
+        return int(round(value))
+
+    return value
+
+
+def main(
+    robot: str = "panda",                  # Robot to tune for
+    planner: str = "rrtc",                 # Planner name to tune
+    dataset: str = "problems.pkl",         # Pickled dataset to tune on
+    problem: Union[str, List[str]] = [],   # Problem name or list of problems of the scene family
+    output: str = "tuned.json",            # Tuned settings file to write
+    candidates: int = 81,                  # Number of sampled settings, including the defaults
+    eta: int = 3,                          # Only the best 1 / eta candidates are kept after each round
+    min_problems: int = 8,                 # Problems each candidate is evaluated on in the first round
+    max_problems: int = 0,                 # Problems the last round evaluates on, or all if zero
+    trials: int = 1,                       # Number of trials of each problem, each with a skipped sampler
+    tune_simplify: bool = False,           # Also tune the settings of simplification
+    cost_weight: float = 0.0,              # Microseconds of time worth one unit of simplified path cost
+    sampler: str = "halton",               # Sampler to use.
+    seed: int = 0,                         # Seed for sampling candidates and ordering problems
+    **kwargs,                              # Fixed settings, which are not tuned
+    ):
+
+    if robot not in vamp.robots:
+        raise RuntimeError(f"Robot {robot} does not exist in VAMP!")
+
+    if planner not in SEARCH_SPACES:
+        raise RuntimeError(f"Planner {planner} cannot be tuned! Tunable planners: {list(SEARCH_SPACES)}")
+
+    problems_dir = Path(__file__).parent.parent / 'resources' / robot / 'problems'
+    with open(problems_dir.parent / dataset, 'rb') as f:
+        problems = pickle.load(f)
+
+    problem_names = list(problems['problems'].keys())
+    if isinstance(problem, str):
+        problem = [problem]
+
+    if not problem:
+        problem = problem_names
+    else:
+        for problem_name in problem:
+            if problem_name not in problem_names:
+                raise RuntimeError(
+                    f"Problem `{problem_name}` not available! Available problems: {problem_names}"
+                    )
+
+    rng = random.Random(seed)
+
+    # Rounds evaluate on growing prefixes of one shuffled order, so that later rounds reuse earlier results
+    instances = [
+        data
+        for name, pset in problems['problems'].items()
+        if name in problem
+        for data in pset
+        if data['valid']
+        ]
+    rng.shuffle(instances)
+    if max_problems:
+        instances = instances[:max_problems]
+
+    environments = [vamp.problem_dict_to_vamp(data) for data in instances]
+
+    space = dict(SEARCH_SPACES[planner])
+    if tune_simplify:
+        space.update(SIMPLIFY_SPACE)
+
+    for k in kwargs:
+        space.pop(k, None)
+
+    # The first candidate is the defaults, so that tuning never reports settings worse than them
+    population = [dict(kwargs)]
+    for _ in range(candidates - 1):
+        population.append({**kwargs, **{k: sample_value(v, rng) for k, v in space.items()}})
+
+    configured = []
+    for settings in population:
+        with redirect_stdout(io.StringIO()):
+            configured.append(vamp.configure_robot_and_planner_with_kwargs(robot, planner, **settings))
+
+    vamp_module = configured[0][0]
+    planner_async = getattr(vamp_module, f"{planner}_async")
+
+    # Results of each (candidate, instance, trial) as (solved, total time in microseconds, cost)
+    results: Dict[Tuple[int, int, int], Tuple[bool, float, float]] = {}
+
+    def evaluate(survivors: List[int], n_instances: int):
+        # Every query of a round is in flight at once on the native thread pool. Candidates of a round run
+        # under the same load, so their times remain comparable, though slower than a single query alone.
+        pending = [(c, i, t)
+                   for c in survivors
+                   for i in range(n_instances)
+                   for t in range(trials)
+                   if (c, i, t) not in results]
+
+        futures = []
+        for c, i, t in pending:
+            _, _, plan_settings, _ = configured[c]
+            trial_rng = getattr(vamp_module, sampler)()
+            trial_rng.skip(t * 10000)
+            data = instances[i]
+            futures.append(
+                planner_async(data['start'], data['goals'], environments[i], plan_settings, trial_rng)
+                )
+
+        simplify_futures = []
+        for (c, i, t), future in zip(pending, futures):
+            result = future.result()
+            if not result.solved:
+                simplify_futures.append(None)
+                continue
+
+            _, _, _, simp_settings = configured[c]
+            trial_rng = getattr(vamp_module, sampler)()
+            trial_rng.skip(t * 10000)
+            simplify_futures.append(
+                vamp_module.simplify_async(result.path, environments[i], simp_settings, trial_rng)
+                )
+
+        for (c, i, t), future, simplify_future in zip(pending, futures, simplify_futures):
+            result = future.result()
+            if simplify_future is None:
+                # Failed queries count with the time they spent before giving up
+                results[(c, i, t)] = (False, result.nanoseconds / 1e3, math.inf)
+                continue
+
+            simple = simplify_future.result()
+            results[(c, i, t)] = (
+                True, (result.nanoseconds + simple.nanoseconds) / 1e3, simple.path.cost()
+                )
+
+    def score(c: int, n_instances: int) -> Tuple[int, float, float, float]:
+        trial_results = [results[(c, i, t)] for i in range(n_instances) for t in range(trials)]
+        failures = sum(not solved for solved, _, _ in trial_results)
+        total_time = float(np.mean([t_us for _, t_us, _ in trial_results]))
+        costs = [cost for solved, _, cost in trial_results if solved]
+        cost = float(np.mean(costs)) if costs else math.inf
+        objective = total_time + cost_weight * cost if cost_weight else total_time
+
+        # Candidates that fail more problems rank lower, regardless of their time
+        return failures, objective, total_time, cost
+
+    tick = time.perf_counter()
+
+    survivors = list(range(len(population)))
+    n_instances = min(min_problems, len(instances))
+    round_index = 0
+    while True:
+        evaluate(survivors, n_instances)
+        survivors.sort(key = lambda c: score(c, n_instances)[:2])
+
+        best = score(survivors[0], n_instances)
+        print(
+            f"Round {round_index}: {len(survivors)} candidates on {n_instances} problems, "
+            f"best has {best[0]} failures and objective {best[1]:.2f}"
+            )
+
+        if len(survivors) == 1 or n_instances == len(instances):
+            break
+
+        survivors = survivors[:max(1, len(survivors) // eta)]
+        n_instances = min(n_instances * eta, len(instances))
+        round_index += 1
+
+    tock = time.perf_counter()
+
+    # Compare the best candidate against the defaults on the same problems
+    evaluate([0, survivors[0]], n_instances)
+
+    rows = []
+    for name, c in [("default", 0), ("tuned", survivors[0])]:
+        failures, objective, total_time, cost = score(c, n_instances)
+        rows.append([name, failures, total_time, cost, objective])
+
+    print(
+        tabulate(
+            rows,
+            headers = ["", "Failures", "Total Time (μs)", "Simplified Cost (L2)", "Objective"],
+            tablefmt = "github",
+            )
+        )
+    print(f"Tuned over {len(instances)} problems in {tock - tick:.2f} seconds")
+
+    tuned = {
+        "robot": robot,
+        "planner": planner,
+        "dataset": dataset,
+        "problems": problem,
+        "cost_weight": cost_weight,
+        "settings": population[survivors[0]],
+        }
+
+    with open(output, 'w') as f:
+        json.dump(tuned, f, indent = 2)
+
+    print(f"Wrote tuned settings to {output}")
+
+
+if __name__ == "__main__":
+    Fire(main)
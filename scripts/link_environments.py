@@ -0,0 +1,100 @@
+import re
+from pathlib import Path
+from typing import Dict, List, Optional
+
+from prune_self_collisions import HEADER_DIRECTORY, LINK_COMMENT, SELF_SECTION_START, sphere_links
+
+N_SPHERES = re.compile(r"static constexpr std::size_t n_spheres = (\d+);\n")
+JOINT_NAMES_END = re.compile(r"static constexpr std::array<std::string_view, dimension> joint_names = \{[^}]*\};\n")
+UNLINKED_TEST = re.compile(r"sphere_environment_in_collision\(environment, (?=y\[)")
+
+COLUMN_LIMIT = 110
+
+
+def link_order(source: str) -> List[str]:
+    """Links in the order their blocks first appear in the environment collision section of fkcc."""
+    start = source.index("inline static bool fkcc(")
+    end = source.index(SELF_SECTION_START, start)
+
+    order = []
+    for line in source[start:end].splitlines():
+        comment = LINK_COMMENT.match(line)
+        if comment and comment.group(1) not in order:
+            order.append(comment.group(1))
+
+    return order
+
+
+def wrap(items: List[str], indent: str) -> str:
+    lines = []
+    line = indent
+    for item in items:
+        if len(line) + len(item) + 2 > COLUMN_LIMIT and line.strip():
+            lines.append(line.rstrip())
+            line = indent
+
+        line += item + ", "
+
+    lines.append(line[:-2])
+    return "\n".join(lines)
+
+
+def metadata(links: List[str], spheres: Dict[int, str]) -> str:
+    names = "\n".join(f'            "{link}",' for link in links)[:-1]
+    indices = wrap([str(links.index(spheres[i])) for i in range(len(spheres))], " " * 12)
+    return (
+        f"        static constexpr std::array<std::string_view, n_links> link_names = {{\n{names}}};\n"
+        f"        static constexpr std::array<std::size_t, n_spheres> sphere_links = {{\n{indices}}};\n"
+        )
+
+
+def annotate(source: str, n_spheres: int) -> str:
+    spheres = sphere_links(source, n_spheres)
+    if len(spheres) != n_spheres:
+        raise RuntimeError(f"Only found links for {len(spheres)} of {n_spheres} spheres!")
+
+    links = link_order(source)
+    index = {link: i for i, link in enumerate(links)}
+
+    if "n_links" not in source:
+        source = N_SPHERES.sub(
+            lambda m: m.group(0) + f"        static constexpr std::size_t n_links = {len(links)};\n",
+            source,
+            count = 1,
+            )
+        source = JOINT_NAMES_END.sub(lambda m: m.group(0) + metadata(links, spheres), source, count = 1)
+
+    # Every environment test is routed through the subset of obstacles in reach of its link
+    lines = []
+    link = None
+    for line in source.splitlines(keepends = True):
+        comment = LINK_COMMENT.match(line.rstrip("\n"))
+        if comment:
+            link = comment.group(1)
+
+        if UNLINKED_TEST.search(line):
+            line = UNLINKED_TEST.sub(f"sphere_environment_in_collision(environment, {index[link]}, ", line)
+
+        lines.append(line)
+
+    return "".join(lines)
+
+
+def main(
+    robot: str = "panda",
+    header: Optional[str] = None,  # Defaults to the robot's generated header in this repository
+    output: Optional[str] = None,  # Defaults to overwriting the header
+    ):
+    header_path = Path(header) if header else HEADER_DIRECTORY / f"{robot}.hh"
+    source = header_path.read_text()
+
+    n_spheres = int(N_SPHERES.search(source).group(1))
+    annotated = annotate(source, n_spheres)
+
+    print(f"{robot}: {len(link_order(source))} links, {len(UNLINKED_TEST.findall(source))} environment tests")
+    Path(output or header_path).write_text(annotated)
+
+
+if __name__ == "__main__":
+    from fire import Fire
+    Fire(main)
@@ -0,0 +1,162 @@
+import re
+from collections import defaultdict
+from pathlib import Path
+from typing import Callable, Dict, List, Optional, Set, Tuple
+
+HEADER_DIRECTORY = Path(__file__).parent.parent / "src" / "impl" / "vamp" / "robots"
+
+ENVIRONMENT_TEST = re.compile(r"sphere_environment_in_collision\(environment, (?:\d+, )?y\[(\d+)\]")
+LINK_COMMENT = re.compile(r"^\s*// (\S+)$")
+
+# A self-collision test that immediately rejects, i.e., a sphere pair rather than a link bounding sphere gate
+SELF_TEST = re.compile(
+    r"( *)if \(sphere_sphere_self_collision<decltype\(x\[0\]\)>\(([^(){};]*)\)\)\s*\{\s*return false;\s*\}\n\n?"
+    )
+EMPTY_GATE = re.compile(
+    r"( *)// \S+ vs\. \S+\n *if \(sphere_sphere_self_collision<decltype\(x\[0\]\)>\([^(){};]*\)\)\s*\{\s*\}\n\n?"
+    )
+DANGLING_COMMENT = re.compile(r" *// \S+ vs\. \S+\n(?=\s*(// \S+ vs\.|return true;))")
+
+SELF_SECTION_START = "// robot self-collisions"
+SELF_SECTION_END = "return true;"
+
+
+def sphere_links(source: str, n_spheres: int) -> Dict[int, str]:
+    """Maps each sphere to its link, using the per-link blocks of the environment collision section."""
+    links = {}
+    link = None
+    for line in source[:source.index(SELF_SECTION_START)].splitlines():
+        comment = LINK_COMMENT.match(line)
+        if comment:
+            link = comment.group(1)
+            continue
+
+        for index in ENVIRONMENT_TEST.findall(line):
+            sphere = int(index) // 4
+            if sphere < n_spheres:
+                links[sphere] = link
+
+    return links
+
+
+def self_sections(source: str) -> List[Tuple[int, int]]:
+    """Spans of every self-collision section, one each in fkcc and fkcc_attach."""
+    sections = []
+    start = source.find(SELF_SECTION_START)
+    while start != -1:
+        end = source.index(SELF_SECTION_END, start)
+        sections.append((start, end))
+        start = source.find(SELF_SECTION_START, end)
+
+    return sections
+
+
+def link_clearances(
+        links: Dict[int, str],
+        clearance: Callable[[int, int], float],
+    ) -> Dict[Tuple[str, str], float]:
+    """Minimum sampled clearance between any two spheres of each pair of links."""
+    members = defaultdict(list)
+    for sphere, link in links.items():
+        members[link].append(sphere)
+
+    names = sorted(members)
+    result = {}
+    for i, a in enumerate(names):
+        for b in names[i + 1:]:
+            result[(a, b)] = min(clearance(sa, sb) for sa in members[a] for sb in members[b])
+
+    return result
+
+
+def prune_section(section: str, links: Dict[int, str], allowed: Set[Tuple[str, str]]) -> Tuple[str, int, int]:
+    """Removes every sphere pair test between allowed link pairs, then any gates and comments left empty."""
+    before = 0
+    removed = 0
+
+    def replace(match: re.Match) -> str:
+        nonlocal before, removed
+        before += 1
+
+        spheres = [int(index) // 4 for index in re.findall(r"y\[(\d+)\]", match.group(2))]
+        pair = tuple(sorted((links[spheres[0]], links[spheres[4]])))
+        if pair in allowed:
+            removed += 1
+            return ""
+
+        return match.group(0)
+
+    section = SELF_TEST.sub(replace, section)
+    section = EMPTY_GATE.sub("", section)
+    section = DANGLING_COMMENT.sub("", section)
+    section = re.sub(r"\n\n( *)\}", r"\n\1}", section)
+    return section, before, removed
+
+
+def prune(
+        source: str,
+        n_spheres: int,
+        clearance: Callable[[int, int], float],
+        margin: float,
+    ) -> Tuple[str, Dict[Tuple[str, str], float], Set[Tuple[str, str]], List[Tuple[int, int]]]:
+    links = sphere_links(source, n_spheres)
+    if len(links) != n_spheres:
+        raise RuntimeError(f"Only found links for {len(links)} of {n_spheres} spheres!")
+
+    clearances = link_clearances(links, clearance)
+    allowed = {pair for pair, value in clearances.items() if value > margin}
+
+    counts = []
+    pieces = []
+    last = 0
+    for start, end in self_sections(source):
+        section, before, removed = prune_section(source[start:end], links, allowed)
+        pieces.extend([source[last:start], section])
+        counts.append((before, removed))
+        last = end
+
+    pieces.append(source[last:])
+    return "".join(pieces), clearances, allowed, counts
+
+
+def main(
+    robot: str = "panda",
+    samples: int = 10_000_000,  # Number of configurations sampled within joint limits
+    margin: float = 0.05,  # Minimum sampled clearance (in meters) for a link pair to be pruned
+    sampler_name: str = "halton",
+    header: Optional[str] = None,  # Defaults to the robot's generated header in this repository
+    output: Optional[str] = None,  # Defaults to overwriting the header
+    dry_run: bool = False,
+    ):
+    import vamp
+    import numpy as np
+
+    robot_module = getattr(vamp, robot)
+    header_path = Path(header) if header else HEADER_DIRECTORY / f"{robot}.hh"
+    source = header_path.read_text()
+
+    rng = getattr(robot_module, sampler_name)()
+    clearances = np.asarray(robot_module.sphere_clearances(samples, rng))
+
+    pruned, link_pairs, allowed, counts = prune(
+        source,
+        robot_module.n_spheres(),
+        lambda a, b: float(clearances[a, b]),
+        margin,
+        )
+
+    print(f"Sampled {samples} configurations of {robot}.")
+    for pair, value in sorted(link_pairs.items(), key = lambda item: item[1]):
+        if pair in allowed:
+            print(f"  never collide: {pair[0]} vs. {pair[1]} (minimum clearance {value:.4f} m)")
+
+    for name, (before, removed) in zip(["fkcc", "fkcc_attach"], counts):
+        print(f"{name}: removed {removed} of {before} self-collision sphere tests")
+
+    if not dry_run:
+        Path(output or header_path).write_text(pruned)
+
+
+if __name__ == "__main__":
+    from fire import Fire
+    Fire(main)
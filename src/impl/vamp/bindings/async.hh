@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#else
+#include <fcntl.h>
+#endif
+
+#include <vamp/thread_pool.hh>
+
+namespace vamp::binding
+{
+    // Shared by all robots, so that requests to any robot queue on the same threads
+    inline auto thread_pool() -> vamp::utils::ThreadPool &
+    {
+        static vamp::utils::ThreadPool pool;
+        return pool;
+    }
+
+    // Result of a job running on the thread pool. Completion is also signalled by making a file descriptor
+    // readable, which event loops (e.g., asyncio) can watch without blocking.
+    template <typename T>
+    class Future
+    {
+    public:
+        using Ptr = std::shared_ptr<Future<T>>;
+
+        Future()
+        {
+#if defined(__linux__)
+            read_fd = write_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (read_fd < 0)
+            {
+                throw std::runtime_error("Failed to create eventfd for future!");
+            }
+#else
+            int fds[2];
+            if (pipe(fds) != 0)
+            {
+                throw std::runtime_error("Failed to create pipe for future!");
+            }
+
+            read_fd = fds[0];
+            write_fd = fds[1];
+            for (const auto fd : fds)
+            {
+                fcntl(fd, F_SETFD, FD_CLOEXEC);
+                fcntl(fd, F_SETFL, O_NONBLOCK);
+            }
+#endif
+        }
+
+        Future(const Future &) = delete;
+        auto operator=(const Future &) -> Future & = delete;
+
+        ~Future()
+        {
+            close(read_fd);
+            if (write_fd != read_fd)
+            {
+                close(write_fd);
+            }
+        }
+
+        // Runs a job on the thread pool, returning the future for its result
+        template <typename F>
+        inline static auto submit(F &&job) -> Ptr
+        {
+            auto future = std::make_shared<Future<T>>();
+            thread_pool().submit(
+                [future, job = std::forward<F>(job)]() mutable
+                {
+                    try
+                    {
+                        future->set(job());
+                    }
+                    catch (...)
+                    {
+                        future->fail(std::current_exception());
+                    }
+                });
+
+            return future;
+        }
+
+        // Readable once the result is available
+        [[nodiscard]] inline auto fileno() const noexcept -> int
+        {
+            return read_fd;
+        }
+
+        [[nodiscard]] inline auto done() const noexcept -> bool
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return finished;
+        }
+
+        inline void wait() const
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            completed.wait(lock, [this]() { return finished; });
+        }
+
+        // Blocks until the job has finished, then returns its result or rethrows its exception
+        inline auto result() const -> T
+        {
+            wait();
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+
+            return *value;
+        }
+
+    private:
+        inline void set(T &&result)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                value.emplace(std::move(result));
+                finished = true;
+            }
+
+            notify();
+        }
+
+        inline void fail(std::exception_ptr exception)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = std::move(exception);
+                finished = true;
+            }
+
+            notify();
+        }
+
+        inline void notify()
+        {
+            completed.notify_all();
+
+#if defined(__linux__)
+            const std::uint64_t one = 1;
+            [[maybe_unused]] auto written = write(write_fd, &one, sizeof(one));
+#else
+            const char one = 1;
+            [[maybe_unused]] auto written = write(write_fd, &one, sizeof(one));
+#endif
+        }
+
+        int read_fd = -1;
+        int write_fd = -1;
+
+        mutable std::mutex mutex;
+        mutable std::condition_variable completed;
+        bool finished = false;
+        std::optional<T> value;
+        std::exception_ptr error;
+    };
+}  // namespace vamp::binding
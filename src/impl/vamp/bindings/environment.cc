@@ -1,9 +1,16 @@
 #include <vamp_python_init.hh>
 
+#include <vamp/collision/accumulator.hh>
 #include <vamp/collision/filter.hh>
 #include <vamp/collision/capt.hh>
 #include <vamp/collision/factory.hh>
+#include <vamp/collision/pointcloud_bvh.hh>
+#include <vamp/collision/sampling.hh>
 #include <vamp/collision/shapes.hh>
+#include <vamp/collision/shared.hh>
+#include <vamp/collision/tiled_heightfield.hh>
+#include <vamp/robots/reachability.hh>
+#include <vamp/robots/reachability_map.hh>
 
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/pair.h>
@@ -104,7 +111,48 @@ void vamp::binding::init_environment(nanobind::module_ &pymodule)
         .def_ro("xs", &vc::HeightField<float>::xs)
         .def_ro("ys", &vc::HeightField<float>::ys)
         .def_ro("zs", &vc::HeightField<float>::zs)
-        .def_ro("data", &vc::HeightField<float>::data);
+        .def_prop_ro("data", [](const vc::HeightField<float> &h) { return h.data.to_vector(); });
+
+    nb::class_<vc::TiledHeightField>(pymodule, "TiledHeightField")
+        .def_static(
+            "open",
+            &vc::TiledHeightField::open,
+            "filename"_a,
+            "Map a tiled heightfield file read-only. Tiles are only read from disk when checked against.")
+        .def_ro("origin", &vc::TiledHeightField::origin)
+        .def_ro("cell_size", &vc::TiledHeightField::cell_size)
+        .def_ro("width", &vc::TiledHeightField::width)
+        .def_ro("height", &vc::TiledHeightField::height)
+        .def_ro("tile_size", &vc::TiledHeightField::tile_size)
+        .def_ro("filename", &vc::TiledHeightField::filename)
+        .def(
+            "advise",
+            &vc::TiledHeightField::advise,
+            "x"_a,
+            "y"_a,
+            "radius"_a,
+            "Page in the tiles within `radius` of (x, y), and allow all other tiles to be dropped from "
+            "memory.");
+
+    pymodule.def(
+        "write_tiled_heightfield",
+        [](const std::string &filename,
+           const nb::ndarray<float, nb::ndim<2>, nb::c_contig, nb::device::cpu> &heights,
+           const collision::Point &origin,
+           float cell_size,
+           std::size_t tile_size)
+        {
+            vc::TiledHeightField::write(
+                filename, heights.data(), heights.shape(1), heights.shape(0), origin, cell_size, tile_size);
+        },
+        "filename"_a,
+        "heights"_a,
+        "origin"_a,
+        "cell_size"_a,
+        "tile_size"_a = 64,
+        "Write a (height, width) array of heights to a tiled heightfield file. Cell (i, j) of the array "
+        "covers [j, j + 1) x [i, i + 1) cells from `origin`, and its height is relative to the z of "
+        "`origin`.");
 
     nb::class_<vc::Environment<float>>(pymodule, "Environment")
         .def(nb::init<>())
@@ -147,6 +195,10 @@ void vamp::binding::init_environment(nanobind::module_ &pymodule)
             "add_heightfield",
             [](vc::Environment<float> &e, const vc::HeightField<float> &s)
             { e.heightfields.emplace_back(s); })
+        .def(
+            "add_tiled_heightfield",
+            [](vc::Environment<float> &e, const vc::TiledHeightField &t)
+            { e.tiled_heightfields.emplace_back(t); })
         .def(
             "add_pointcloud",
             [](vc::Environment<float> &e,
@@ -157,12 +209,103 @@ void vamp::binding::init_environment(nanobind::module_ &pymodule)
             {
                 auto start_time = std::chrono::steady_clock::now();
                 e.pointclouds.emplace_back(pc, r_min, r_max, r_point);
+                e.pointcloud_bvh.clear();
                 return vamp::utils::get_elapsed_nanoseconds(start_time);
             })
+        .def(
+            "merge_pointclouds",
+            [](vc::Environment<float> &e, std::size_t max_points)
+            {
+                vc::merge_pointclouds(e.pointclouds, max_points);
+                e.pointcloud_bvh.clear();
+            },
+            "max_points"_a,
+            "Merge pointclouds with at most max_points points and the same radii into shared CAPTs.")
         .def(
             "attach",
             [](vc::Environment<float> &e, const vc::Attachment<float> &a) { e.attachments.emplace(a); })
-        .def("detach", [](vc::Environment<float> &e) { e.attachments.reset(); });
+        .def("detach", [](vc::Environment<float> &e) { e.attachments.reset(); })
+        .def_prop_ro(
+            "compiled",
+            [](const vc::Environment<float> &e) { return e.links != nullptr; },
+            "True if per-link subsets have been compiled since primitives were last added.");
+
+    pymodule.def(
+        "share_environment",
+        &vc::shared::create,
+        "environment"_a,
+        "name"_a,
+        "Compile an environment into a new POSIX shared memory segment, returning its size in bytes.");
+
+    pymodule.def(
+        "attach_environment",
+        &vc::shared::attach,
+        "name"_a,
+        "Map a shared environment read-only. Pointclouds and heightfields are not copied.");
+
+    pymodule.def(
+        "unlink_environment",
+        &vc::shared::unlink,
+        "name"_a,
+        "Remove the name of a shared environment. Processes that already attached keep their mapping.");
+
+    nb::class_<vamp::robots::LinkReach>(pymodule, "LinkReach")
+        .def(nb::init<>())
+        .def_rw("lower", &vamp::robots::LinkReach::lower)
+        .def_rw("upper", &vamp::robots::LinkReach::upper);
+
+    nb::class_<vamp::robots::ReachabilitySettings>(pymodule, "ReachabilitySettings")
+        .def(nb::init<>())
+        .def_rw("voxel_size", &vamp::robots::ReachabilitySettings::voxel_size)
+        .def_rw("workspace_min", &vamp::robots::ReachabilitySettings::workspace_min)
+        .def_rw("workspace_max", &vamp::robots::ReachabilitySettings::workspace_max)
+        .def_rw("n_samples", &vamp::robots::ReachabilitySettings::n_samples)
+        .def_rw("seed", &vamp::robots::ReachabilitySettings::seed)
+        .def_rw("n_threads", &vamp::robots::ReachabilitySettings::n_threads);
+
+    using ReachabilityMap = vamp::robots::ReachabilityMap;
+    nb::class_<ReachabilityMap>(pymodule, "ReachabilityMap")
+        .def(nb::init<>())
+        .def_ro("origin", &ReachabilityMap::origin)
+        .def_ro("voxel_size", &ReachabilityMap::voxel_size)
+        .def_ro("dims", &ReachabilityMap::dims)
+        .def_ro_static("n_directions", &ReachabilityMap::n_directions)
+        .def(
+            "counts",
+            [](const ReachabilityMap &m)
+            {
+                auto *counts = new std::vector<std::uint32_t>(m.counts);
+                using Counts = std::vector<std::uint32_t>;
+                nb::capsule owner(counts, [](void *c) noexcept { delete reinterpret_cast<Counts *>(c); });
+                return nb::ndarray<nb::numpy, std::uint32_t, nb::device::cpu>(
+                    counts->data(), {m.dims[0], m.dims[1], m.dims[2]}, owner);
+            },
+            "Number of valid samples that reached each voxel, as an array indexed by voxel coordinates.")
+        .def(
+            "reachability",
+            &ReachabilityMap::reachability,
+            "point"_a,
+            "Fraction of approach directions the end-effector reached at a point.")
+        .def("index", &ReachabilityMap::index, "point"_a)
+        .def("center", &ReachabilityMap::center, "index"_a)
+        .def("save", &ReachabilityMap::save, "filename"_a)
+        .def("load", &ReachabilityMap::load, "filename"_a)
+        .def("__len__", &ReachabilityMap::size);
+
+    pymodule.def(
+        "filter_reachable",
+        [](const std::vector<collision::Point> &pc,
+           const std::vector<vamp::robots::LinkReach> &reach,
+           float r_point) -> std::pair<std::vector<collision::Point>, std::size_t>
+        {
+            auto start_time = std::chrono::steady_clock::now();
+            auto filtered = vamp::robots::filter_reachable(pc, reach, r_point);
+            return {filtered, vamp::utils::get_elapsed_nanoseconds(start_time)};
+        },
+        "pointcloud"_a,
+        "reach"_a,
+        "r_point"_a,
+        "Drop points of a pointcloud that no link can reach.");
 
     pymodule.def(
         "filter_pointcloud",
@@ -196,6 +339,122 @@ void vamp::binding::init_environment(nanobind::module_ &pymodule)
             return {filtered, vamp::utils::get_elapsed_nanoseconds(start_time)};
         });
 
+    pymodule.def(
+        "sample_surfaces",
+        [](const vc::Environment<float> &environment,
+           std::size_t n,
+           float noise,
+           std::uint64_t seed,
+           bool flat_caps,
+           std::size_t n_threads)
+        {
+            std::vector<collision::Point> *points;
+            {
+                nb::gil_scoped_release release;
+                points = new std::vector<collision::Point>(
+                    vc::sampling::sample_surfaces(environment, n, noise, seed, flat_caps, n_threads));
+            }
+
+            using Points = std::vector<collision::Point>;
+            nb::capsule points_owner(points, [](void *p) noexcept { delete reinterpret_cast<Points *>(p); });
+            return nb::ndarray<nb::numpy, float, nb::device::cpu>(
+                reinterpret_cast<float *>(points->data()), {points->size(), 3}, points_owner);
+        },
+        "environment"_a,
+        "n"_a,
+        "noise"_a = 0.F,
+        "seed"_a = 0,
+        "flat_caps"_a = false,
+        "n_threads"_a = std::thread::hardware_concurrency(),
+        "Sample `n` points from the surface of each sphere, cuboid, cylinder, and capsule in an environment, "
+        "returned as an (N, 3) array. Uniform noise in [-noise, noise] is added to each coordinate. If "
+        "`flat_caps`, capsules are sampled as cylinders.");
+
+    using PointCloudArray = nb::ndarray<float, nb::shape<-1, 3>, nb::device::cpu>;
+    const auto to_isometry = [](const Eigen::Matrix4f &tf)
+    {
+        Eigen::Isometry3f iso;
+        iso.matrix() = tf;
+        return iso;
+    };
+
+    nb::class_<vc::PointCloudAccumulator>(pymodule, "PointCloudAccumulator")
+        .def(
+            "__init__",
+            [](vc::PointCloudAccumulator *q,
+               float voxel_size,
+               double decay,
+               const collision::Point &workspace_min,
+               const collision::Point &workspace_max,
+               std::size_t n_threads)
+            {
+                new (q) vc::PointCloudAccumulator(
+                    vc::AccumulatorSettings{voxel_size, decay, workspace_min, workspace_max, n_threads});
+            },
+            "voxel_size"_a = 0.01F,
+            "decay"_a = 1.,
+            "workspace_min"_a = collision::Point{-10.F, -10.F, -10.F},
+            "workspace_max"_a = collision::Point{10.F, 10.F, 10.F},
+            "n_threads"_a = std::thread::hardware_concurrency(),
+            "Fuses pointclouds from many sensors over time, keeping one point per voxel. Voxels expire "
+            "`decay` seconds after they were last observed.")
+        .def(
+            "add_sensor",
+            [to_isometry](vc::PointCloudAccumulator &a, const Eigen::Matrix4f &tf)
+            { return a.add_sensor(to_isometry(tf)); },
+            "extrinsic"_a = Eigen::Matrix4f(Eigen::Matrix4f::Identity()),
+            "Register a sensor with its transform into the world frame, returning its index.")
+        .def(
+            "set_extrinsic",
+            [to_isometry](vc::PointCloudAccumulator &a, std::size_t sensor, const Eigen::Matrix4f &tf)
+            { a.set_extrinsic(sensor, to_isometry(tf)); },
+            "sensor"_a,
+            "extrinsic"_a)
+        .def(
+            "ingest",
+            [](vc::PointCloudAccumulator &a, std::size_t sensor, const PointCloudArray &pc, double time)
+            {
+                nb::gil_scoped_release release;
+                a.ingest(sensor, pc, time);
+            },
+            "sensor"_a,
+            "pointcloud"_a,
+            "time"_a)
+        .def(
+            "ingest",
+            [](vc::PointCloudAccumulator &a,
+               std::size_t sensor,
+               const std::vector<collision::Point> &pc,
+               double time) { a.ingest(sensor, pc, time); },
+            "sensor"_a,
+            "pointcloud"_a,
+            "time"_a)
+        .def(
+            "ingest",
+            [](vc::PointCloudAccumulator &a,
+               const std::vector<std::size_t> &sensors,
+               const std::vector<PointCloudArray> &pcs,
+               double time)
+            {
+                nb::gil_scoped_release release;
+                a.ingest(sensors, pcs, time);
+            },
+            "sensors"_a,
+            "pointclouds"_a,
+            "time"_a,
+            "Ingest one frame per sensor, all captured at `time`. Frames are processed in parallel.")
+        .def("expire", &vc::PointCloudAccumulator::expire, "time"_a)
+        .def(
+            "points",
+            [](vc::PointCloudAccumulator &a, double time) { return a.points(time); },
+            "time"_a,
+            "Expire old voxels, then return one point per occupied voxel, ready for `add_pointcloud()`. Only "
+            "regions that changed since the last call are re-emitted.")
+        .def("clear", &vc::PointCloudAccumulator::clear)
+        .def_prop_ro("n_sensors", &vc::PointCloudAccumulator::n_sensors)
+        .def_prop_ro("version", &vc::PointCloudAccumulator::version)
+        .def("__len__", &vc::PointCloudAccumulator::size);
+
     nb::class_<vc::Attachment<float>>(pymodule, "Attachment")
         .def(
             "__init__",
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <exception>
+#include <stdexcept>
+#include <string>
+
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 
@@ -13,20 +17,32 @@
 #include <stdexcept>
 #endif
 
+#include <vamp/bindings/async.hh>
 #include <vamp/collision/sphere_sphere.hh>
 #include <vamp/collision/validity.hh>
 #include <vamp/planning/validate.hh>
+#include <vamp/planning/batch.hh>
+#include <vamp/planning/cartesian.hh>
+#include <vamp/planning/constrained.hh>
 #include <vamp/planning/simplify.hh>
 #include <vamp/planning/plan.hh>
 #include <vamp/planning/prm.hh>
 #include <vamp/planning/fcit.hh>
 #include <vamp/planning/rrtc.hh>
 #include <vamp/planning/aorrtc.hh>
+#include <vamp/planning/experience.hh>
+#include <vamp/planning/repair.hh>
+#include <vamp/planning/swept.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/robots/reachability.hh>
+#include <vamp/robots/reachability_map.hh>
+#include <vamp/robots/self_collision.hh>
 #include <vamp/vector.hh>
 
 #include <nanobind/nanobind.h>
 #include <nanobind/make_iterator.h>
 #include <nanobind/stl/array.h>
+#include <nanobind/stl/optional.h>
 #include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 #include <nanobind/stl/string.h>
@@ -165,12 +181,39 @@ namespace vamp::binding
         using EnvironmentInput = vamp::collision::Environment<float>;
         using EnvironmentVector = vamp::collision::Environment<vamp::FloatVector<rake>>;
 
+        // Per-link subsets compiled for another robot, or other bounds, are dropped by the conversion.
+        // Pointclouds built for smaller spheres than the robot's, e.g., before its instance inflated them,
+        // would miss collisions, so they are rejected.
+        inline static auto vectorize(const EnvironmentInput &environment) -> EnvironmentVector
+        {
+            const auto r_max = vamp::robots::Instance<Robot>::current().min_max_radii().second;
+            for (const auto &pointcloud : environment.pointclouds)
+            {
+                if (pointcloud.r_max < r_max)
+                {
+                    throw std::runtime_error(
+                        "Pointcloud was built for spheres of radius at most " +
+                        std::to_string(pointcloud.r_max) + ", but the robot's spheres have radii up to " +
+                        std::to_string(r_max) + "!");
+                }
+            }
+
+            return EnvironmentVector::template for_robot<Robot>(environment);
+        }
+
         using Path = vamp::planning::Path<Robot>;
         using PlanningResult = vamp::planning::PlanningResult<Robot>;
+        using CartesianResult = vamp::planning::CartesianResult<Robot>;
         using Roadmap = vamp::planning::Roadmap<Robot>;
 
         using RNG = vamp::rng::RNG<Robot>;
 
+        // Asynchronous variants convert their inputs on the calling thread, so that no Python objects are
+        // touched by the thread pool, and run with the robot instance bound to the calling thread. Each query
+        // samples from its own fork of the given RNG, so concurrent queries may be given the same RNG.
+        using Instance = vamp::robots::Instance<Robot>;
+        using PlanningFuture = Future<PlanningResult>;
+
         template <typename Planner, typename Settings>
         struct PlannerHelper
         {
@@ -182,7 +225,7 @@ namespace vamp::binding
                 typename RNG::Ptr rng) -> PlanningResult
             {
                 return Planner::solve(
-                    Input::to(start), Input::to(goal), EnvironmentVector(environment), settings, rng);
+                    Input::to(start), Input::to(goal), vectorize(environment), settings, rng);
             }
 
             inline static auto multi(
@@ -200,8 +243,159 @@ namespace vamp::binding
                     goals_v.emplace_back(Input::to(goal));
                 }
 
-                return Planner::solve(
-                    Input::to(start), goals_v, EnvironmentVector(environment), settings, rng);
+                return Planner::solve(Input::to(start), goals_v, vectorize(environment), settings, rng);
+            }
+
+            inline static auto single_async(
+                const Type &start,
+                const Type &goal,
+                const EnvironmentInput &environment,
+                const Settings &settings,
+                typename RNG::Ptr rng) -> typename PlanningFuture::Ptr
+            {
+                return PlanningFuture::submit(
+                    [start = Input::to(start),
+                     goal = Input::to(goal),
+                     environment = vectorize(environment),
+                     settings,
+                     rng = rng->fork(),
+                     instance = Instance::current()]()
+                    {
+                        typename Instance::Scope scope(instance);
+                        return Planner::solve(start, goal, environment, settings, rng);
+                    });
+            }
+
+            inline static auto multi_async(
+                const Type &start,
+                const std::vector<Type> &goals,
+                const EnvironmentInput &environment,
+                const Settings &settings,
+                typename RNG::Ptr rng) -> typename PlanningFuture::Ptr
+            {
+                std::vector<Configuration> goals_v;
+                goals_v.reserve(goals.size());
+
+                for (const auto &goal : goals)
+                {
+                    goals_v.emplace_back(Input::to(goal));
+                }
+
+                return PlanningFuture::submit(
+                    [start = Input::to(start),
+                     goals = std::move(goals_v),
+                     environment = vectorize(environment),
+                     settings,
+                     rng = rng->fork(),
+                     instance = Instance::current()]()
+                    {
+                        typename Instance::Scope scope(instance);
+                        return Planner::solve(start, goals, environment, settings, rng);
+                    });
+            }
+
+            // Anytime planning that reports each improved solution to a Python callback, which is only called
+            // between searches and with the GIL held. A truthy return stops the search. An exception raised
+            // by the callback also stops it, and is raised again once the planner returns.
+            inline static auto callback(
+                const Type &start,
+                const std::vector<Type> &goals,
+                const EnvironmentInput &environment,
+                const Settings &settings,
+                typename RNG::Ptr rng,
+                const nanobind::callable &on_solution) -> PlanningResult
+            {
+                std::vector<Configuration> goals_v;
+                goals_v.reserve(goals.size());
+
+                for (const auto &goal : goals)
+                {
+                    goals_v.emplace_back(Input::to(goal));
+                }
+
+                std::exception_ptr error;
+                auto result = Planner::solve(
+                    Input::to(start),
+                    goals_v,
+                    vectorize(environment),
+                    settings,
+                    rng,
+                    [&](const Path &path, float cost)
+                    {
+                        try
+                        {
+                            const auto stop = PyObject_IsTrue(on_solution(path, cost).ptr());
+                            if (stop < 0)
+                            {
+                                throw nanobind::python_error();
+                            }
+
+                            return stop == 1;
+                        }
+                        catch (...)
+                        {
+                            error = std::current_exception();
+                            return true;
+                        }
+                    });
+
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+
+                return result;
+            }
+
+            inline static auto single_callback(
+                const Type &start,
+                const Type &goal,
+                const EnvironmentInput &environment,
+                const Settings &settings,
+                typename RNG::Ptr rng,
+                const nanobind::callable &on_solution) -> PlanningResult
+            {
+                return callback(start, std::vector<Type>{goal}, environment, settings, rng, on_solution);
+            }
+
+            // Inputs are converted while holding the GIL, which is then released while the batch runs
+            inline static auto batch(
+                const std::vector<std::tuple<Type, std::vector<Type>>> &queries,
+                const EnvironmentInput &environment,
+                const Settings &settings,
+                const std::optional<vamp::planning::SimplifySettings> &simplify_settings,
+                std::uint64_t seed,
+                std::size_t n_threads)
+            {
+                std::vector<vamp::planning::BatchQuery<Robot>> queries_v;
+                queries_v.reserve(queries.size());
+
+                for (const auto &[start, goals] : queries)
+                {
+                    auto &query = queries_v.emplace_back();
+                    query.start = Input::to(start);
+                    for (const auto &goal : goals)
+                    {
+                        query.goals.emplace_back(Input::to(goal));
+                    }
+                }
+
+                std::vector<vamp::planning::BatchResult<Robot>> results;
+                {
+                    nanobind::gil_scoped_release release;
+                    const auto environment_v = vectorize(environment);
+                    results = vamp::planning::solve_batch<Robot, rake, Robot::resolution, Planner>(
+                        queries_v, environment_v, settings, simplify_settings, seed, n_threads);
+                }
+
+                std::vector<std::tuple<PlanningResult, std::optional<PlanningResult>>> out;
+                out.reserve(results.size());
+                for (auto &result : results)
+                {
+                    out.emplace_back(std::move(result.plan), std::move(result.simplified));
+                }
+
+                return out;
             }
 
             inline static auto roadmap(
@@ -212,7 +406,7 @@ namespace vamp::binding
                 typename RNG::Ptr rng) -> Roadmap
             {
                 return Planner::build_roadmap(
-                    Input::to(start), Input::to(goal), EnvironmentVector(environment), settings, rng);
+                    Input::to(start), Input::to(goal), vectorize(environment), settings, rng);
             }
         };
 
@@ -231,6 +425,49 @@ namespace vamp::binding
             vamp::planning::AORRTC<Robot, rake, Robot::resolution>,
             vamp::planning::AORRTCSettings>;
 
+        using ConstrainedRRTC = PlannerHelper<
+            vamp::planning::ConstrainedRRTC<Robot, rake, Robot::resolution>,
+            vamp::planning::ConstrainedRRTCSettings>;
+
+        using ExperienceDatabase = vamp::planning::ExperienceDatabase<Robot>;
+
+        struct Experience
+        {
+            using Planner = vamp::planning::Experience<Robot, rake, Robot::resolution>;
+
+            inline static auto single(
+                const Type &start,
+                const Type &goal,
+                const EnvironmentInput &environment,
+                const vamp::planning::ExperienceSettings &settings,
+                ExperienceDatabase &database,
+                typename RNG::Ptr rng) -> PlanningResult
+            {
+                return Planner::solve(
+                    Input::to(start), Input::to(goal), vectorize(environment), settings, database, rng);
+            }
+
+            inline static auto multi(
+                const Type &start,
+                const std::vector<Type> &goals,
+                const EnvironmentInput &environment,
+                const vamp::planning::ExperienceSettings &settings,
+                ExperienceDatabase &database,
+                typename RNG::Ptr rng) -> PlanningResult
+            {
+                std::vector<Configuration> goals_v;
+                goals_v.reserve(goals.size());
+
+                for (const auto &goal : goals)
+                {
+                    goals_v.emplace_back(Input::to(goal));
+                }
+
+                return Planner::solve(
+                    Input::to(start), goals_v, vectorize(environment), settings, database, rng);
+            }
+        };
+
         inline static auto fk(const Type &c_in) -> std::vector<vamp::collision::Sphere<float>>
         {
             typename Robot::template Spheres<1> out;
@@ -249,7 +486,7 @@ namespace vamp::binding
         inline static auto debug(const Type &c_in, const EnvironmentInput &environment) ->
             typename Robot::Debug
         {
-            return Robot::fkcc_debug(EnvironmentVector(environment), Input::template block<rake>(c_in));
+            return Robot::fkcc_debug(vectorize(environment), Input::template block<rake>(c_in));
         }
 
         inline static auto
@@ -257,13 +494,13 @@ namespace vamp::binding
         {
             auto configuration = Input::to(c_in);
             auto copy = configuration.trim();
-            Robot::descale_configuration(copy);
+            vamp::robots::Instance<Robot>::current().descale_configuration(copy);
 
             const bool in_bounds = (copy <= 1.F).all() and (copy >= 0.F).all();
 
             return (not check_bounds or in_bounds) and
                    vamp::planning::validate_motion<Robot, rake, 1>(
-                       configuration, configuration, EnvironmentVector(environment));
+                       configuration, configuration, vectorize(environment));
         }
 
         inline static auto validate_motion(
@@ -272,21 +509,23 @@ namespace vamp::binding
             const EnvironmentInput &environment,
             bool check_bounds = false) -> bool
         {
+            const auto &instance = vamp::robots::Instance<Robot>::current();
+
             auto configuration_in = Input::to(c_in);
             auto copy_in = configuration_in.trim();
-            Robot::descale_configuration(copy_in);
+            instance.descale_configuration(copy_in);
 
             const bool in_bounds_in = (copy_in <= 1.F).all() and (copy_in >= 0.F).all();
 
             auto configuration_out = Input::to(c_out);
             auto copy_out = configuration_out.trim();
-            Robot::descale_configuration(copy_out);
+            instance.descale_configuration(copy_out);
 
             const bool in_bounds_out = (copy_out <= 1.F).all() and (copy_out >= 0.F).all();
 
             return (not check_bounds or (in_bounds_in and in_bounds_out)) and
                    vamp::planning::validate_motion<Robot, rake, 1>(
-                       configuration_in, configuration_out, EnvironmentVector(environment));
+                       configuration_in, configuration_out, vectorize(environment));
         }
 
         inline static auto simplify(
@@ -296,7 +535,36 @@ namespace vamp::binding
             typename RNG::Ptr rng) -> PlanningResult
         {
             return vamp::planning::simplify<Robot, rake, Robot::resolution>(
-                path, EnvironmentVector(environment), settings, rng);
+                path, vectorize(environment), settings, rng);
+        }
+
+        inline static auto simplify_async(
+            const Path &path,
+            const EnvironmentInput &environment,
+            const vamp::planning::SimplifySettings &settings,
+            typename RNG::Ptr rng) -> typename PlanningFuture::Ptr
+        {
+            return PlanningFuture::submit(
+                [path,
+                 environment = vectorize(environment),
+                 settings,
+                 rng = rng->fork(),
+                 instance = Instance::current()]()
+                {
+                    typename Instance::Scope scope(instance);
+                    return vamp::planning::simplify<Robot, rake, Robot::resolution>(
+                        path, environment, settings, rng);
+                });
+        }
+
+        inline static auto repair(
+            const Path &path,
+            const EnvironmentInput &environment,
+            const vamp::planning::RepairSettings &settings,
+            typename RNG::Ptr rng) -> PlanningResult
+        {
+            return vamp::planning::repair<Robot, rake, Robot::resolution>(
+                path, vectorize(environment), settings, rng);
         }
 
         inline static auto eefk(const Type &start) -> Eigen::Matrix4f
@@ -304,6 +572,19 @@ namespace vamp::binding
             return Robot::eefk(Input::array(start)).matrix();
         }
 
+        inline static auto cartesian(
+            const Type &start,
+            const Eigen::Matrix4f &goal,
+            const EnvironmentInput &environment,
+            const vamp::planning::CartesianSettings &settings) -> CartesianResult
+        {
+            Eigen::Isometry3f goal_pose;
+            goal_pose.matrix() = goal;
+
+            return vamp::planning::cartesian_path<Robot, rake, Robot::resolution>(
+                Input::to(start), goal_pose, vectorize(environment), settings);
+        }
+
         inline static auto filter_self_from_pointcloud(
             const std::vector<collision::Point> &pc,
             float point_radius,
@@ -311,7 +592,7 @@ namespace vamp::binding
             const EnvironmentInput &environment) -> std::vector<collision::Point>
         {
             // TODO: Do this smarter with SIMD CC
-            EnvironmentVector ev(environment);
+            const auto ev = vectorize(environment);
 
             typename Robot::template Spheres<1> out;
             Robot::template sphere_fk<1>(Input::template block<1>(c_in), out);
@@ -371,13 +652,19 @@ namespace vamp::binding
         submodule.def(
             "n_spheres", []() { return Robot::n_spheres; }, "Number of spheres in robot collision model.");
         submodule.def(
-            "space_measure", []() { return Robot::space_measure(); }, "Measure of robot's C-space.");
+            "space_measure",
+            []() { return Robot::space_measure(); },
+            "Measure of robot's C-space.");
         submodule.def(
             "min_max_radii",
-            []() -> std::pair<float, float> { return {Robot::min_radius, Robot::max_radius}; },
-            "Minimum and maximum radii sizes of robot spheres.");
+            []() { return vamp::robots::Instance<Robot>::current().min_max_radii(); },
+            "Minimum and maximum radii of robot spheres, including the inflation of the current instance.");
         submodule.def(
             "joint_names", []() { return Robot::joint_names; }, "Joint names for the robot in order of DoF");
+        submodule.def(
+            "link_names",
+            []() { return Robot::link_names; },
+            "Link names for the robot in order of collision model link index.");
         submodule.def("end_effector", []() { return Robot::end_effector; }, "End-effector frame name.");
 
         submodule.def(
@@ -387,7 +674,7 @@ namespace vamp::binding
                 std::array<float, Robot::dimension> ones;
                 ones.fill(1.0f);
                 auto one_v = typename Robot::Configuration(ones);
-                Robot::scale_configuration(one_v);
+                vamp::robots::Instance<Robot>::current().scale_configuration(one_v);
                 return NA::from(one_v);
             });
         submodule.def(
@@ -397,9 +684,47 @@ namespace vamp::binding
                 std::array<float, Robot::dimension> zeros;
                 zeros.fill(0.0f);
                 auto zero_v = typename Robot::Configuration(zeros);
-                Robot::scale_configuration(zero_v);
+                vamp::robots::Instance<Robot>::current().scale_configuration(zero_v);
                 return NA::from(zero_v);
             });
+        using Instance = vamp::robots::Instance<Robot>;
+        using InstanceScopes = std::vector<std::unique_ptr<typename Instance::Scope>>;
+        static thread_local InstanceScopes instance_scopes;
+
+        nb::class_<Instance>(
+            submodule,
+            "Instance",
+            "Runtime robot parameters. Within a `with` block, planning, sampling, and validation on this "
+            "thread use its bounds and sphere inflation instead of the robot's defaults.")
+            .def(nb::init<>(), "Instance with the robot's default bounds.")
+            .def(
+                nb::init<const typename Instance::ConfigurationArray &,
+                         const typename Instance::ConfigurationArray &,
+                         float>(),
+                "lows"_a,
+                "highs"_a,
+                "inflation"_a = 0.F,
+                "Instance with the given bounds. Sphere inflation is only honored by the sphere and generic "
+                "robots.")
+            .def_prop_ro("lows", &Instance::lows)
+            .def_prop_ro("highs", &Instance::highs)
+            .def_ro("inflation", &Instance::inflation)
+            .def("min_max_radii", &Instance::min_max_radii)
+            .def(
+                "__enter__",
+                [](const Instance &instance) -> const Instance &
+                {
+                    instance_scopes.emplace_back(std::make_unique<typename Instance::Scope>(instance));
+                    return instance;
+                },
+                nb::rv_policy::reference)
+            .def("__exit__", [](const Instance &, nb::args) { instance_scopes.pop_back(); });
+
+        submodule.def(
+            "current_instance",
+            []() { return Instance::current(); },
+            "Copy of the instance bound to this thread, or of the defaults.");
+
         using RNG = vamp::rng::RNG<Robot>;
         nb::class_<typename RNG::Ptr>(submodule, "RNG", "RNG for robot configurations.")
             .def(
@@ -410,6 +735,10 @@ namespace vamp::binding
                 "next",
                 [](typename RNG::Ptr rng) -> NDArray { return NA::from(rng->next()); },
                 "Sample the next configuration. Modifies internal RNG state.")
+            .def(
+                "fork",
+                [](typename RNG::Ptr rng) { return rng->fork(); },
+                "Independent RNG whose stream is drawn from this one, for use on another thread.")
             .def(
                 "skip",
                 [](typename RNG::Ptr rng, std::size_t n)
@@ -421,6 +750,66 @@ namespace vamp::binding
                 },
                 "Skip the next n iterations.");
 
+        submodule.def(
+            "sphere_clearances",
+            [](std::size_t n_samples, typename RNG::Ptr rng)
+            {
+                const auto clearances = vamp::robots::sample_sphere_clearances<Robot, rake>(n_samples, rng);
+
+                auto *arr = new FloatT[clearances.size()];
+                std::copy(clearances.cbegin(), clearances.cend(), arr);
+
+                nb::capsule arr_owner(arr, [](void *a) noexcept { delete[] reinterpret_cast<FloatT *>(a); });
+                return nb::ndarray<nb::numpy, const FloatT, nb::device::cpu>(
+                    arr, {Robot::n_spheres, Robot::n_spheres}, arr_owner);
+            },
+            "n_samples"_a,
+            "rng"_a,
+            "Minimum signed distance between each pair of robot spheres over sampled configurations.");
+
+        // Per-link subsets attached from shared memory find how to check their bounds by robot name
+        vamp::collision::CompiledLinks::register_check(
+            Robot::name, &vamp::robots::within_compiled_bounds<Robot>);
+
+        submodule.def(
+            "link_reach",
+            [](std::size_t n_samples, float margin, typename RNG::Ptr rng)
+            { return vamp::robots::sample_link_reach<Robot, rake>(n_samples, margin, rng); },
+            "n_samples"_a,
+            "margin"_a,
+            "rng"_a,
+            "Bounds on the space reachable by each link within the current bounds, found by sampling "
+            "configurations and climbing from the samples to the extremes of each link.");
+
+        submodule.def(
+            "compile_environment",
+            [](vamp::collision::Environment<float> &environment,
+               const std::vector<vamp::robots::LinkReach> &reach)
+            {
+                if (reach.size() != Robot::n_links)
+                {
+                    throw std::runtime_error("Link reach does not match the links of this robot!");
+                }
+
+                vamp::robots::compile_environment<Robot>(environment, reach);
+            },
+            "environment"_a,
+            "reach"_a,
+            "Build per-link subsets of the environment's primitives from the reach of each link.");
+
+        submodule.def(
+            "reachability_map",
+            [](const vamp::collision::Environment<float> &environment,
+               const vamp::robots::ReachabilitySettings &settings)
+            {
+                nb::gil_scoped_release release;
+                return vamp::robots::build_reachability_map<Robot>(environment, settings);
+            },
+            "environment"_a,
+            "settings"_a,
+            "Bin the end-effector poses of sampled valid configurations into a voxel and approach direction "
+            "grid.");
+
         using PHS = vamp::planning::ProlateHyperspheroid<Robot>;
         nb::class_<PHS>(submodule, "ProlateHyperspheroid", "Prolate Hyperspheroid for Robot.")
             .def(
@@ -503,10 +892,28 @@ namespace vamp::binding
                 "validate",
                 [](Path &p, const typename HPN::EnvironmentInput &e)
                 {
-                    const typename HPN::EnvironmentVector ev(e);
+                    const auto ev = HPN::vectorize(e);
                     return p.template validate<rake>(ev);
                 },
                 "Validate the path in an environment.")
+            .def(
+                "invalid_segments",
+                [](const Path &p, const typename HPN::EnvironmentInput &e)
+                {
+                    const auto ev = HPN::vectorize(e);
+                    return vamp::planning::validate_path<Robot, rake, Robot::resolution>(p, ev)
+                        .invalid_segments();
+                },
+                "Indices of the segments of the path that are invalid in an environment.")
+            .def(
+                "swept_volume",
+                [](const Path &p, float r_min, float r_max)
+                { return vamp::planning::sweep<Robot, rake, Robot::resolution>(p, r_min, r_max); },
+                "r_min"_a,
+                "r_max"_a,
+                "Environment of the volume swept by the robot's spheres along the path, at collision "
+                "checking resolution. Checking configurations or spheres with radii in [r_min, r_max] "
+                "against it tests them against the whole path.")
             .def(
                 "numpy",
                 [](const Path &p) noexcept
@@ -540,6 +947,70 @@ namespace vamp::binding
                 "Number of planner iterations used to find the path.")
             .def_ro("size", &HPN::PlanningResult::size, "Size of the internal planner datastructures.");
 
+        nb::class_<typename HPN::CartesianResult>(
+            submodule, "CartesianResult", "Result of following a straight line in Cartesian space.")
+            .def_ro("path", &HPN::CartesianResult::path, "The path, up to the last waypoint reached.")
+            .def_ro(
+                "fraction", &HPN::CartesianResult::fraction, "Fraction of the line that the path follows.")
+            .def_ro("nanoseconds", &HPN::CartesianResult::nanoseconds, "Nanoseconds taken.");
+
+        using PlanningFuture = typename HPN::PlanningFuture;
+        nb::class_<typename PlanningFuture::Ptr>(
+            submodule, "PlanningFuture", "Result of a planning query running on the thread pool.")
+            .def(
+                "done",
+                [](const typename PlanningFuture::Ptr &f) { return f->done(); },
+                "Returns true if the query has finished.")
+            .def(
+                "fileno",
+                [](const typename PlanningFuture::Ptr &f) { return f->fileno(); },
+                "File descriptor that becomes readable when the query finishes.")
+            .def(
+                "result",
+                [](const typename PlanningFuture::Ptr &f)
+                {
+                    {
+                        nb::gil_scoped_release release;
+                        f->wait();
+                    }
+
+                    return f->result();
+                },
+                "Wait for the query to finish and return its result.")
+            .def(
+                "__await__",
+                [](nb::handle f)
+                { return nb::module_::import_("vamp.aio").attr("wait")(f).attr("__await__")(); },
+                "Wait for the query to finish without blocking the event loop.");
+
+        using ExperienceDatabase = typename HPN::ExperienceDatabase;
+        nb::class_<ExperienceDatabase>(
+            submodule, "ExperienceDatabase", "Database of prior solutions for experience-based planning.")
+            .def(nb::init<>(), "Empty constructor.")
+            .def(
+                "__len__",
+                [](const ExperienceDatabase &d) { return d.size(); },
+                "Return the number of stored paths.")
+            .def(
+                "__getitem__",
+                [](const ExperienceDatabase &d, std::size_t i) -> Path { return d[i]; },
+                "Get the i-th stored path.")
+            .def(
+                "add",
+                &ExperienceDatabase::add,
+                "path"_a,
+                "Store a path of two or more configurations, keyed on its first and last. Returns its index.")
+            .def(
+                "save",
+                &ExperienceDatabase::save,
+                "filename"_a,
+                "Write all stored paths to a file. Returns true on success.")
+            .def(
+                "load",
+                &ExperienceDatabase::load,
+                "filename"_a,
+                "Append all paths stored in a file, or none if it is malformed. Returns true on success.");
+
         nb::class_<typename HPN::Roadmap>(submodule, "Roadmap", "Undirected graph in configuration space.")
             .def(nb::init<>(), "Empty constructor.")
             .def(
@@ -568,6 +1039,24 @@ namespace vamp::binding
             "rng"_a,
             "Simplification heuristics to post-process a path.");
 
+        submodule.def(
+            "simplify_async",
+            HPN::simplify_async,
+            "path"_a,
+            "environment"_a,
+            "settings"_a,
+            "rng"_a,
+            "Simplification heuristics to post-process a path, run on the thread pool. Returns a future.");
+
+        submodule.def(
+            "repair",
+            HPN::repair,
+            "path"_a,
+            "environment"_a,
+            "settings"_a,
+            "rng"_a,
+            "Replan only the invalid spans of a path with a bounded RRTC, then re-simplify them locally.");
+
 #define MF(name, func, desc, ...)                                                                            \
     submodule.def(name, HPN::func, ##__VA_ARGS__, desc);                                                     \
     submodule.def(name, HPA::func, ##__VA_ARGS__, desc);
@@ -582,6 +1071,16 @@ namespace vamp::binding
            "Computes the forward kinematics of the robot's end-effector. Returns XYZ and a XYZW quaternion.",
            "configuration"_a);
 
+        MF("cartesian",
+           cartesian,
+           "Moves the end-effector along a straight line from its pose at the start to a goal pose, given "
+           "as a 4x4 transform, solving IK for each waypoint. Stops early if IK fails or a motion is "
+           "invalid, and returns the path so far with the fraction of the line it follows.",
+           "start"_a,
+           "goal"_a,
+           "environment"_a,
+           "settings"_a = vamp::planning::CartesianSettings());
+
         MF("debug",
            debug,
            "Check which spheres of a robot configuration are in collision.",
@@ -622,12 +1121,85 @@ namespace vamp::binding
 
 #define PLANNER(name, func, desc, ...)                                                                       \
     MF(name, func::single, desc, "start"_a, "goal"_a, "environment"_a, "settings"_a, "rng"_a);               \
-    MF(name, func::multi, desc, "start"_a, "goal"_a, "environment"_a, "settings"_a, "rng"_a);
+    MF(name, func::multi, desc, "start"_a, "goal"_a, "environment"_a, "settings"_a, "rng"_a);                \
+    MF(name "_async",                                                                                        \
+       func::single_async,                                                                                   \
+       desc ", run on the thread pool. Returns a future.",                                                   \
+       "start"_a,                                                                                            \
+       "goal"_a,                                                                                             \
+       "environment"_a,                                                                                      \
+       "settings"_a,                                                                                         \
+       "rng"_a);                                                                                             \
+    MF(name "_async",                                                                                        \
+       func::multi_async,                                                                                    \
+       desc ", run on the thread pool. Returns a future.",                                                   \
+       "start"_a,                                                                                            \
+       "goal"_a,                                                                                             \
+       "environment"_a,                                                                                      \
+       "settings"_a,                                                                                         \
+       "rng"_a);                                                                                             \
+    MF(name "_batch",                                                                                        \
+       func::batch,                                                                                          \
+       desc " for a list of (start, goals) queries, run across threads with work stealing. Each query "      \
+       "draws from a random stream keyed by `seed` and its index. Returns a (plan, simplified) tuple per "   \
+       "query, in order, where simplified is None unless `simplify` settings are given and the query was "   \
+       "solved.",                                                                                            \
+       "queries"_a,                                                                                          \
+       "environment"_a,                                                                                      \
+       "settings"_a,                                                                                         \
+       "simplify"_a = nanobind::none(),                                                                      \
+       "seed"_a = 0,                                                                                         \
+       "n_threads"_a = std::thread::hardware_concurrency());
 
         PLANNER("rrtc", RRTC, "RRTConnect");
         PLANNER("prm", PRM, "PRM");
         PLANNER("fcit", FCIT, "FCIT");
         PLANNER("aorrtc", AORRTC, "AORRTC");
+        PLANNER("constrained_rrtc", ConstrainedRRTC, "Orientation-constrained RRTConnect");
+
+#define ANYTIME_PLANNER(name, func, desc)                                                                    \
+    MF(name,                                                                                                 \
+       func::single_callback,                                                                                \
+       desc ", calling `on_solution(path, cost)` with each improved solution. Returning True stops the "     \
+       "search.",                                                                                            \
+       "start"_a,                                                                                            \
+       "goal"_a,                                                                                             \
+       "environment"_a,                                                                                      \
+       "settings"_a,                                                                                         \
+       "rng"_a,                                                                                              \
+       "on_solution"_a);                                                                                     \
+    MF(name,                                                                                                 \
+       func::callback,                                                                                       \
+       desc ", calling `on_solution(path, cost)` with each improved solution. Returning True stops the "     \
+       "search.",                                                                                            \
+       "start"_a,                                                                                            \
+       "goal"_a,                                                                                             \
+       "environment"_a,                                                                                      \
+       "settings"_a,                                                                                         \
+       "rng"_a,                                                                                              \
+       "on_solution"_a);
+
+        ANYTIME_PLANNER("fcit", FCIT, "FCIT");
+        ANYTIME_PLANNER("aorrtc", AORRTC, "AORRTC");
+
+        MF("experience",
+           Experience::single,
+           "Experience-based planning: retrieve, repair, or plan and store a solution.",
+           "start"_a,
+           "goal"_a,
+           "environment"_a,
+           "settings"_a,
+           "database"_a,
+           "rng"_a);
+        MF("experience",
+           Experience::multi,
+           "Experience-based planning: retrieve, repair, or plan and store a solution.",
+           "start"_a,
+           "goal"_a,
+           "environment"_a,
+           "settings"_a,
+           "database"_a,
+           "rng"_a);
 
         if constexpr (has_set_lows_v<Robot>)
         {
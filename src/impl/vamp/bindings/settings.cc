@@ -3,8 +3,13 @@
 #include <vamp/planning/roadmap.hh>
 #include <vamp/planning/rrtc_settings.hh>
 #include <vamp/planning/aorrtc_settings.hh>
+#include <vamp/planning/cartesian_settings.hh>
+#include <vamp/planning/constrained_settings.hh>
+#include <vamp/planning/experience_settings.hh>
+#include <vamp/planning/repair_settings.hh>
 #include <vamp/planning/simplify_settings.hh>
 
+#include <nanobind/stl/array.h>
 #include <nanobind/stl/vector.h>
 
 namespace nb = nanobind;
@@ -39,6 +44,52 @@ void vamp::binding::init_settings(nanobind::module_ &pymodule)
         .def_rw("max_cost_bound_resamples", &vp::AORRTCSettings::max_cost_bound_resamples)
         .def_rw("max_samples", &vp::AORRTCSettings::max_samples);
 
+    nb::class_<vp::RepairSettings>(pymodule, "RepairSettings")
+        .def(nb::init<>())
+        .def_rw("rrtc", &vp::RepairSettings::rrtc)
+        .def_rw("max_iterations", &vp::RepairSettings::max_iterations)
+        .def_rw("max_samples", &vp::RepairSettings::max_samples)
+        .def_rw("simplify_local", &vp::RepairSettings::simplify_local)
+        .def_rw("context", &vp::RepairSettings::context)
+        .def_rw("simplify", &vp::RepairSettings::simplify);
+
+    nb::class_<vp::IKSettings>(pymodule, "IKSettings")
+        .def(nb::init<>())
+        .def_rw("position_tolerance", &vp::IKSettings::position_tolerance)
+        .def_rw("orientation_tolerance", &vp::IKSettings::orientation_tolerance)
+        .def_rw("damping", &vp::IKSettings::damping)
+        .def_rw("max_step", &vp::IKSettings::max_step)
+        .def_rw("jacobian_step", &vp::IKSettings::jacobian_step)
+        .def_rw("max_iterations", &vp::IKSettings::max_iterations);
+
+    nb::class_<vp::CartesianSettings>(pymodule, "CartesianSettings")
+        .def(nb::init<>())
+        .def_rw("ik", &vp::CartesianSettings::ik)
+        .def_rw("max_translation_step", &vp::CartesianSettings::max_translation_step)
+        .def_rw("max_rotation_step", &vp::CartesianSettings::max_rotation_step)
+        .def_rw("max_joint_jump", &vp::CartesianSettings::max_joint_jump);
+
+    nb::class_<vp::OrientationConstraint>(pymodule, "OrientationConstraint")
+        .def(nb::init<>())
+        .def_rw("axis", &vp::OrientationConstraint::axis)
+        .def_rw("direction", &vp::OrientationConstraint::direction)
+        .def_rw("tolerance", &vp::OrientationConstraint::tolerance);
+
+    nb::class_<vp::ConstrainedRRTCSettings>(pymodule, "ConstrainedRRTCSettings")
+        .def(nb::init<>())
+        .def_rw("rrtc", &vp::ConstrainedRRTCSettings::rrtc)
+        .def_rw("constraint", &vp::ConstrainedRRTCSettings::constraint)
+        .def_rw("projection", &vp::ConstrainedRRTCSettings::projection)
+        .def_rw("step", &vp::ConstrainedRRTCSettings::step);
+
+    nb::class_<vp::ExperienceSettings>(pymodule, "ExperienceSettings")
+        .def(nb::init<>())
+        .def_rw("k", &vp::ExperienceSettings::k)
+        .def_rw("repair", &vp::ExperienceSettings::repair)
+        .def_rw("rrtc", &vp::ExperienceSettings::rrtc)
+        .def_rw("simplify", &vp::ExperienceSettings::simplify)
+        .def_rw("store", &vp::ExperienceSettings::store);
+
     // TODO: Redesign a neater form of RoadmapSettings/NeighborParams
     // TODO: Expose the other NeighborParams types
     nb::class_<vp::PRMStarNeighborParams>(pymodule, "PRMNeighborParams")
@@ -0,0 +1,436 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Geometry>
+
+#include <vamp/collision/math.hh>
+#include <vamp/thread_pool.hh>
+
+namespace vamp::collision
+{
+    struct AccumulatorSettings
+    {
+        // Edge length of a voxel. At most one point is kept per voxel, so this plays the role of
+        // `min_dist` in filter_pointcloud().
+        float voxel_size = 0.01F;
+
+        // Seconds a voxel is kept after it was last observed. Non-positive values keep voxels forever.
+        double decay = 1.;
+
+        // Points outside of this box (in the world frame) are dropped on ingest
+        Point workspace_min = {-10.F, -10.F, -10.F};
+        Point workspace_max = {10.F, 10.F, 10.F};
+
+        std::size_t n_threads = std::thread::hardware_concurrency();
+    };
+
+    // Fuses pointclouds from many sensors and frames into a voxel hash map, and emits one point per occupied
+    // voxel, ready to be given to the CAPT constructor without any further filtering.
+    //
+    // Voxels are grouped into cubic chunks, and chunks are spread over shards by hash. Ingest first
+    // transforms and bins the points of each frame in parallel, then merges the bins into the shards in
+    // parallel, in the order the frames were given so the result does not depend on scheduling. Each chunk
+    // caches its emitted points, and only chunks in which a voxel appeared or expired are re-emitted.
+    // Re-observing an occupied voxel only refreshes its timestamp, and keeps the point it was first seen
+    // with, so a static scene does not cause any re-emission.
+    class PointCloudAccumulator
+    {
+    public:
+        explicit PointCloudAccumulator(AccumulatorSettings settings = {}) : settings(std::move(settings))
+        {
+            if (not(this->settings.voxel_size > 0.F))
+            {
+                throw std::runtime_error("Voxel size must be positive!");
+            }
+
+            const auto &lo = this->settings.workspace_min;
+            const auto &hi = this->settings.workspace_max;
+            const auto extent = this->settings.voxel_size * static_cast<float>(1U << (coordinate_bits - 1));
+            for (auto i = 0U; i < 3; ++i)
+            {
+                if (std::max(std::abs(lo[i]), std::abs(hi[i])) >= extent)
+                {
+                    throw std::runtime_error("Workspace is too large for the voxel size!");
+                }
+            }
+
+            this->settings.n_threads = std::max(this->settings.n_threads, std::size_t(1));
+        }
+
+        // Registers a sensor with the transform from its frame to the world frame, returning its index
+        inline auto add_sensor(const Eigen::Isometry3f &extrinsic = Eigen::Isometry3f::Identity())
+            -> std::size_t
+        {
+            extrinsics.emplace_back(extrinsic);
+            return extrinsics.size() - 1;
+        }
+
+        inline void set_extrinsic(std::size_t sensor, const Eigen::Isometry3f &extrinsic)
+        {
+            check_sensor(sensor);
+            extrinsics[sensor] = extrinsic;
+        }
+
+        [[nodiscard]] inline auto extrinsic(std::size_t sensor) const -> const Eigen::Isometry3f &
+        {
+            check_sensor(sensor);
+            return extrinsics[sensor];
+        }
+
+        [[nodiscard]] inline auto n_sensors() const noexcept -> std::size_t
+        {
+            return extrinsics.size();
+        }
+
+        // Number of occupied voxels
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t
+        {
+            std::size_t n = 0;
+            for (const auto &shard : shards)
+            {
+                n += shard.n_voxels;
+            }
+
+            return n;
+        }
+
+        // Incremented whenever the emitted points change
+        [[nodiscard]] inline auto version() const noexcept -> std::size_t
+        {
+            return emitted_version;
+        }
+
+        // Ingests one frame from each of `sensors[i]`, captured at `time` in seconds. `PointCloud` is either
+        // a vector of points or indexed as in filter_pointcloud().
+        template <typename PointCloud>
+        inline void
+        ingest(const std::vector<std::size_t> &sensors, const std::vector<PointCloud> &clouds, double time)
+        {
+            if (sensors.size() != clouds.size())
+            {
+                throw std::runtime_error("Number of sensors does not match number of pointclouds!");
+            }
+
+            ingest_frames(
+                sensors, [&clouds](std::size_t frame) -> const PointCloud & { return clouds[frame]; }, time);
+        }
+
+        template <typename PointCloud>
+        inline void ingest(std::size_t sensor, const PointCloud &cloud, double time)
+        {
+            ingest_frames({sensor}, [&cloud](std::size_t) -> const PointCloud & { return cloud; }, time);
+        }
+
+        // Drops voxels that have not been observed within the decay of `time`
+        inline void expire(double time)
+        {
+            if (settings.decay <= 0.)
+            {
+                return;
+            }
+
+            const auto cutoff = time - settings.decay;
+            utils::parallel_for(
+                settings.n_threads, n_shards, [&](std::size_t shard) { expire(shards[shard], cutoff); });
+        }
+
+        // Expires old voxels, then returns one point per occupied voxel
+        inline auto points(double time) -> const std::vector<Point> &
+        {
+            expire(time);
+
+            std::atomic<bool> changed = false;
+            utils::parallel_for(
+                settings.n_threads,
+                n_shards,
+                [&](std::size_t shard)
+                {
+                    if (emit(shards[shard]))
+                    {
+                        changed = true;
+                    }
+                });
+
+            if (changed)
+            {
+                emitted.clear();
+                emitted.reserve(size());
+                for (const auto &shard : shards)
+                {
+                    for (const auto &[key, chunk] : shard.chunks)
+                    {
+                        emitted.insert(emitted.end(), chunk.points.cbegin(), chunk.points.cend());
+                    }
+                }
+
+                ++emitted_version;
+            }
+
+            return emitted;
+        }
+
+        inline void clear()
+        {
+            for (auto &shard : shards)
+            {
+                shard.chunks.clear();
+                shard.n_voxels = 0;
+                shard.removed = true;
+            }
+        }
+
+    private:
+        // Voxel coordinates are offset to be unsigned and packed into 21 bits each
+        static constexpr const unsigned int coordinate_bits = 21;
+        static constexpr const std::uint64_t coordinate_mask = (1U << coordinate_bits) - 1;
+        static constexpr const unsigned int chunk_bits = 4;
+        static constexpr const std::uint32_t chunk_mask = (1U << chunk_bits) - 1;
+        static constexpr const unsigned int shard_bits = 6;
+        static constexpr const std::size_t n_shards = 1U << shard_bits;
+
+        struct Observation
+        {
+            std::uint64_t chunk;
+            std::uint16_t voxel;
+            Point point;
+        };
+
+        struct Voxel
+        {
+            Point point;
+            double seen;
+        };
+
+        struct Chunk
+        {
+            std::unordered_map<std::uint16_t, Voxel> voxels;
+
+            // Lower bound on when the voxels of this chunk were last observed
+            double oldest = 0.;
+
+            bool dirty = true;
+            std::vector<Point> points;
+        };
+
+        struct Shard
+        {
+            std::unordered_map<std::uint64_t, Chunk> chunks;
+            std::size_t n_voxels = 0;
+
+            // Whether a chunk has been removed since the last emission
+            bool removed = false;
+        };
+
+        // `clouds(i)` returns the frame captured by `sensors[i]`
+        template <typename Clouds>
+        inline void ingest_frames(const std::vector<std::size_t> &sensors, const Clouds &clouds, double time)
+        {
+            for (const auto sensor : sensors)
+            {
+                check_sensor(sensor);
+            }
+
+            // Step 1: move each frame into the world, and bin its voxels by the shard they belong to
+            std::vector<std::vector<std::vector<Observation>>> bins(sensors.size());
+            utils::parallel_for(
+                settings.n_threads,
+                sensors.size(),
+                [&](std::size_t frame) { bin(extrinsics[sensors[frame]], clouds(frame), bins[frame]); });
+
+            // Step 2: merge the bins of every frame into each shard
+            utils::parallel_for(
+                settings.n_threads,
+                n_shards,
+                [&](std::size_t shard)
+                {
+                    for (const auto &frame : bins)
+                    {
+                        for (const auto &observation : frame[shard])
+                        {
+                            insert(shards[shard], observation, time);
+                        }
+                    }
+                });
+        }
+
+        inline void check_sensor(std::size_t sensor) const
+        {
+            if (sensor >= extrinsics.size())
+            {
+                throw std::runtime_error("Unknown sensor!");
+            }
+        }
+
+        inline static auto shard_of(std::uint64_t chunk) noexcept -> std::size_t
+        {
+            // Fibonacci hashing, as neighboring chunks have similar keys
+            return (chunk * 0x9E3779B97F4A7C15ULL) >> (64 - shard_bits);
+        }
+
+        template <typename PointCloud>
+        inline void bin(
+            const Eigen::Isometry3f &extrinsic,
+            const PointCloud &pc,
+            std::vector<std::vector<Observation>> &out) const
+        {
+            out.resize(n_shards);
+
+            const auto inverse_size = 1.F / settings.voxel_size;
+            const auto &lo = settings.workspace_min;
+            const auto &hi = settings.workspace_max;
+            constexpr const auto offset = 1U << (coordinate_bits - 1);
+
+            const auto point = [&pc](std::size_t i) -> Eigen::Vector3f
+            {
+                if constexpr (std::is_same_v<PointCloud, std::vector<Point>>)
+                {
+                    return {pc[i][0], pc[i][1], pc[i][2]};
+                }
+                else
+                {
+                    return {pc(i, 0), pc(i, 1), pc(i, 2)};
+                }
+            };
+
+            std::size_t n_points;
+            if constexpr (std::is_same_v<PointCloud, std::vector<Point>>)
+            {
+                n_points = pc.size();
+            }
+            else
+            {
+                n_points = pc.shape(0);
+            }
+
+            for (auto i = 0U; i < n_points; ++i)
+            {
+                const Eigen::Vector3f p = extrinsic * point(i);
+
+                // Written so that non-finite points are also dropped
+                if (not(lo[0] <= p[0] and p[0] <= hi[0] and lo[1] <= p[1] and p[1] <= hi[1] and
+                        lo[2] <= p[2] and p[2] <= hi[2]))
+                {
+                    continue;
+                }
+
+                std::uint64_t chunk = 0;
+                std::uint16_t voxel = 0;
+                for (auto j = 0U; j < 3; ++j)
+                {
+                    const auto c = static_cast<std::uint32_t>(
+                        static_cast<std::int32_t>(std::floor(p[j] * inverse_size)) + offset);
+                    chunk |= static_cast<std::uint64_t>((c & coordinate_mask) >> chunk_bits)
+                             << (j * (coordinate_bits - chunk_bits));
+                    voxel |= static_cast<std::uint16_t>((c & chunk_mask) << (j * chunk_bits));
+                }
+
+                out[shard_of(chunk)].emplace_back(Observation{chunk, voxel, {p[0], p[1], p[2]}});
+            }
+        }
+
+        inline static void insert(Shard &shard, const Observation &observation, double time)
+        {
+            auto [chunk_it, new_chunk] = shard.chunks.try_emplace(observation.chunk);
+            auto &chunk = chunk_it->second;
+            if (new_chunk)
+            {
+                chunk.oldest = time;
+            }
+
+            auto [voxel_it, new_voxel] =
+                chunk.voxels.try_emplace(observation.voxel, Voxel{observation.point, time});
+            if (new_voxel)
+            {
+                chunk.oldest = std::min(chunk.oldest, time);
+                chunk.dirty = true;
+                ++shard.n_voxels;
+            }
+            else
+            {
+                voxel_it->second.seen = std::max(voxel_it->second.seen, time);
+            }
+        }
+
+        inline static void expire(Shard &shard, double cutoff)
+        {
+            for (auto chunk_it = shard.chunks.begin(); chunk_it != shard.chunks.end();)
+            {
+                auto &chunk = chunk_it->second;
+                if (chunk.oldest >= cutoff)
+                {
+                    ++chunk_it;
+                    continue;
+                }
+
+                chunk.oldest = std::numeric_limits<double>::max();
+                for (auto voxel_it = chunk.voxels.begin(); voxel_it != chunk.voxels.end();)
+                {
+                    if (voxel_it->second.seen < cutoff)
+                    {
+                        voxel_it = chunk.voxels.erase(voxel_it);
+                        chunk.dirty = true;
+                        --shard.n_voxels;
+                    }
+                    else
+                    {
+                        chunk.oldest = std::min(chunk.oldest, voxel_it->second.seen);
+                        ++voxel_it;
+                    }
+                }
+
+                if (chunk.voxels.empty())
+                {
+                    chunk_it = shard.chunks.erase(chunk_it);
+                    shard.removed = true;
+                }
+                else
+                {
+                    ++chunk_it;
+                }
+            }
+        }
+
+        // Re-emits dirty chunks, returning if anything in the shard changed
+        inline static auto emit(Shard &shard) -> bool
+        {
+            bool changed = std::exchange(shard.removed, false);
+            for (auto &[key, chunk] : shard.chunks)
+            {
+                if (not chunk.dirty)
+                {
+                    continue;
+                }
+
+                chunk.points.clear();
+                chunk.points.reserve(chunk.voxels.size());
+                for (const auto &[index, voxel] : chunk.voxels)
+                {
+                    chunk.points.emplace_back(voxel.point);
+                }
+
+                chunk.dirty = false;
+                changed = true;
+            }
+
+            return changed;
+        }
+
+        AccumulatorSettings settings;
+        std::vector<Eigen::Isometry3f> extrinsics;
+        std::array<Shard, n_shards> shards;
+        std::vector<Point> emitted;
+        std::size_t emitted_version = 0;
+    };
+}  // namespace vamp::collision
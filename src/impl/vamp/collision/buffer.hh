@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace vamp::collision
+{
+    // Immutable array whose storage is shared between copies. The storage is either a vector the buffer took
+    // ownership of, or a view into memory kept alive by some other owner (e.g., a shared memory mapping).
+    // Copies only bump a reference count, so large collision structures are cheap to copy between
+    // environments.
+    template <typename T>
+    class SharedBuffer
+    {
+    public:
+        using value_type = T;
+
+        SharedBuffer() = default;
+
+        template <typename Allocator>
+        explicit SharedBuffer(std::vector<T, Allocator> &&values)
+        {
+            auto owned = std::make_shared<std::vector<T, Allocator>>(std::move(values));
+            ptr = owned->data();
+            n = owned->size();
+            owner = std::move(owned);
+        }
+
+        // View of `n` elements at `ptr`, which must stay valid for as long as `owner` is alive
+        SharedBuffer(const T *ptr, std::size_t n, std::shared_ptr<const void> owner) noexcept
+          : ptr(ptr), n(n), owner(std::move(owner))
+        {
+        }
+
+        [[nodiscard]] inline auto data() const noexcept -> const T *
+        {
+            return ptr;
+        }
+
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t
+        {
+            return n;
+        }
+
+        [[nodiscard]] inline auto empty() const noexcept -> bool
+        {
+            return n == 0;
+        }
+
+        [[nodiscard]] inline auto operator[](std::size_t i) const noexcept -> const T &
+        {
+            return ptr[i];
+        }
+
+        [[nodiscard]] inline auto front() const noexcept -> const T &
+        {
+            return ptr[0];
+        }
+
+        [[nodiscard]] inline auto back() const noexcept -> const T &
+        {
+            return ptr[n - 1];
+        }
+
+        [[nodiscard]] inline auto begin() const noexcept -> const T *
+        {
+            return ptr;
+        }
+
+        [[nodiscard]] inline auto end() const noexcept -> const T *
+        {
+            return ptr + n;
+        }
+
+        [[nodiscard]] inline auto to_vector() const -> std::vector<T>
+        {
+            return std::vector<T>(begin(), end());
+        }
+
+    private:
+        const T *ptr = nullptr;
+        std::size_t n = 0;
+        std::shared_ptr<const void> owner;
+    };
+}  // namespace vamp::collision
@@ -11,6 +11,7 @@
 
 #include <pdqsort.h>
 
+#include <vamp/collision/buffer.hh>
 #include <vamp/collision/math.hh>
 #include <vamp/vector.hh>
 
@@ -101,6 +102,47 @@ namespace vamp::collision
             }
         };
 
+        template <class T>
+        struct AlignedAllocator
+        {
+            using value_type = T;
+            inline static constexpr std::align_val_t alignment{32};
+
+            constexpr AlignedAllocator() noexcept = default;
+            constexpr AlignedAllocator(const AlignedAllocator &) noexcept = default;
+
+            template <typename U>
+            constexpr AlignedAllocator(const AlignedAllocator<U> &) noexcept
+            {
+            }
+
+            [[nodiscard]] value_type *allocate(std::size_t num_elements)
+            {
+                if (num_elements > std::numeric_limits<std::size_t>::max() / sizeof(value_type))
+                {
+                    throw std::bad_array_new_length();
+                }
+
+                const auto num_bytes = num_elements * sizeof(value_type);
+                return reinterpret_cast<value_type *>(::operator new[](num_bytes, alignment));
+            }
+
+            void deallocate(value_type *allocated_ptr, [[maybe_unused]] std::size_t num_allocated_bytes)
+            {
+                ::operator delete[](allocated_ptr, alignment);
+            }
+        };
+
+        // Growable buffers filled in during construction, which are frozen into the shared buffers of the
+        // finished tree.
+        struct Storage
+        {
+            std::vector<float, AlignedAllocator<float>> tests;
+            std::vector<uint32_t, AlignedAllocator<uint32_t>> aff_starts;
+            std::array<std::vector<FVectorT>, 3> affordances;
+            std::vector<Volume> aabbs;
+        };
+
         inline auto median_partition(
             const std::vector<Point> &points,
             std::vector<uint32_t> &argsort,
@@ -126,6 +168,7 @@ namespace vamp::collision
             const float max_affordance_l1,
             const float max_affordance_l2,
             const float min_affordance_l2,
+            Storage &out,
             BuildFrame frame) noexcept -> void
         {
             assert(frame.how_many_points != 0);
@@ -163,9 +206,9 @@ namespace vamp::collision
 
                                 if (j == FVectorT::num_scalars)
                                 {
-                                    affordances[0].emplace_back(xs);
-                                    affordances[1].emplace_back(ys);
-                                    affordances[2].emplace_back(zs);
+                                    out.affordances[0].emplace_back(xs);
+                                    out.affordances[1].emplace_back(ys);
+                                    out.affordances[2].emplace_back(zs);
                                     j = 0;
                                 }
                             }
@@ -182,20 +225,20 @@ namespace vamp::collision
                             zs[jj] = std::numeric_limits<float>::infinity();
                         }
 
-                        affordances[0].emplace_back(xs);
-                        affordances[1].emplace_back(ys);
-                        affordances[2].emplace_back(zs);
+                        out.affordances[0].emplace_back(xs);
+                        out.affordances[1].emplace_back(ys);
+                        out.affordances[2].emplace_back(zs);
                     }
                 }
 
-                aabbs.emplace_back(aabb);
-                aff_starts.emplace_back(affordances[0].size());
+                out.aabbs.emplace_back(aabb);
+                out.aff_starts.emplace_back(out.affordances[0].size());
             }
             else
             {
                 const float test = median_partition(
                     points, argsort, frame.points_begin, frame.points_begin + frame.how_many_points, frame.d);
-                tests[frame.i] = test;
+                out.tests[frame.i] = test;
                 assert(test <= frame.volume.upper[frame.d]);
                 assert(test >= frame.volume.lower[frame.d]);
 
@@ -212,46 +255,45 @@ namespace vamp::collision
                 uint32_t lo_len = 0;
                 for (const auto idx : hi_afford)
                 {
-                    if (points[idx][frame.d] <= test + r_max)
+                    if (points[idx][frame.d] <= test + max_affordance_l1)
                     {
                         lo_afford[lo_len++] = idx;
                     }
 
-                    if (points[idx][frame.d] >= test - r_max)
+                    if (points[idx][frame.d] >= test - max_affordance_l1)
                     {
                         hi_afford[hi_len++] = idx;
                     }
                 }
 
-                uint32_t new_hi_afford = frame.points_begin;
-                uint32_t new_lo_afford = frame.points_begin + next_width;
-                while (new_hi_afford < frame.points_begin + next_width and
-                       points[argsort[new_hi_afford]][frame.d] >= test - r_max and
-                       std::isfinite(points[argsort[new_hi_afford]][frame.d]))
+                // Both halves are sorted in ascending order, so the points of each half that are close to
+                // the test are at the end of the lower half and at the start of the upper half
+                const uint32_t middle = frame.points_begin + next_width;
+                uint32_t new_hi_afford = middle;
+                uint32_t new_lo_afford = middle;
+                while (new_hi_afford > frame.points_begin and
+                       points[argsort[new_hi_afford - 1]][frame.d] >= test - max_affordance_l1 and
+                       std::isfinite(points[argsort[new_hi_afford - 1]][frame.d]))
                 {
-                    ++new_hi_afford;
+                    --new_hi_afford;
                 }
 
                 while (new_lo_afford < frame.points_begin + frame.how_many_points and
-                       points[argsort[new_lo_afford]][frame.d] <= test + r_max and
+                       points[argsort[new_lo_afford]][frame.d] <= test + max_affordance_l1 and
                        std::isfinite(points[argsort[new_lo_afford]][frame.d]))
                 {
                     ++new_lo_afford;
                 }
 
-                uint32_t num_new_hi = new_hi_afford - frame.points_begin;
-                uint32_t num_new_lo = new_lo_afford - (frame.points_begin + next_width);
+                uint32_t num_new_hi = middle - new_hi_afford;
+                uint32_t num_new_lo = new_lo_afford - middle;
 
                 hi_afford.resize(hi_len + num_new_hi);
                 std::copy(
-                    argsort.begin() + frame.points_begin,
-                    argsort.begin() + new_hi_afford,
-                    hi_afford.begin() + hi_len);
+                    argsort.begin() + new_hi_afford, argsort.begin() + middle, hi_afford.begin() + hi_len);
                 lo_afford.resize(lo_len + num_new_lo);
                 std::copy(
-                    argsort.begin() + frame.points_begin + next_width,
-                    argsort.begin() + new_lo_afford,
-                    lo_afford.begin() + lo_len);
+                    argsort.begin() + middle, argsort.begin() + new_lo_afford, lo_afford.begin() + lo_len);
 
                 const uint8_t next_d = (frame.d + 1) % 3;
                 subdivide(
@@ -260,6 +302,7 @@ namespace vamp::collision
                     max_affordance_l1,
                     max_affordance_l2,
                     min_affordance_l2,
+                    out,
                     BuildFrame{
                         frame.points_begin,
                         next_width,
@@ -274,6 +317,7 @@ namespace vamp::collision
                     max_affordance_l1,
                     max_affordance_l2,
                     min_affordance_l2,
+                    out,
                     BuildFrame{
                         frame.points_begin + next_width,
                         next_width,
@@ -330,15 +374,16 @@ namespace vamp::collision
                  -std::numeric_limits<float>::infinity(),
                  -std::numeric_limits<float>::infinity()}};
 
-            tests.reserve(points2.size());
-            tests.insert(tests.end(), points2.size() - 1, std::numeric_limits<float>::quiet_NaN());
+            Storage out;
+            out.tests.reserve(points2.size());
+            out.tests.insert(out.tests.end(), points2.size() - 1, std::numeric_limits<float>::quiet_NaN());
 
-            aff_starts.reserve(points2.size() + 1);
-            aff_starts.emplace_back(0);
+            out.aff_starts.reserve(points2.size() + 1);
+            out.aff_starts.emplace_back(0);
 
-            affordances[0].reserve(points2.size() * 100);
-            affordances[1].reserve(points2.size() * 100);
-            affordances[2].reserve(points2.size() * 100);
+            out.affordances[0].reserve(points2.size() * 100);
+            out.affordances[1].reserve(points2.size() * 100);
+            out.affordances[2].reserve(points2.size() * 100);
 
             std::vector<uint32_t> argsort;
             argsort.resize(points2.size());
@@ -350,6 +395,7 @@ namespace vamp::collision
                 max_affordance_l1,
                 max_affordance_l2,
                 min_affordance_l2,
+                out,
                 BuildFrame{
                     0u,
                     static_cast<uint32_t>(points2.size()),
@@ -362,6 +408,43 @@ namespace vamp::collision
                       std::numeric_limits<float>::infinity(),
                       std::numeric_limits<float>::infinity()}},
                     0u});
+
+            // The affordance buffers were reserved generously, so give back the excess before freezing them
+            for (auto &buffer : out.affordances)
+            {
+                buffer.shrink_to_fit();
+            }
+
+            tests = SharedBuffer<float>(std::move(out.tests));
+            aff_starts = SharedBuffer<uint32_t>(std::move(out.aff_starts));
+            for (auto k = 0U; k < 3; ++k)
+            {
+                affordances[k] = SharedBuffer<FVectorT>(std::move(out.affordances[k]));
+            }
+            aabbs = SharedBuffer<Volume>(std::move(out.aabbs));
+        }
+
+        // Construct a tree from buffers that were already built, e.g., views into shared memory.
+        CAPT(
+            SharedBuffer<float> tests,
+            SharedBuffer<uint32_t> aff_starts,
+            std::array<SharedBuffer<FVectorT>, 3> affordances,
+            SharedBuffer<Volume> aabbs,
+            const Volume &aabb_top,
+            const float r_min,
+            const float r_max,
+            const float r_point,
+            const uint8_t nlog2) noexcept
+          : tests(std::move(tests))
+          , aff_starts(std::move(aff_starts))
+          , affordances(std::move(affordances))
+          , aabbs(std::move(aabbs))
+          , aabb_top(aabb_top)
+          , r_min(r_min)
+          , r_max(r_max)
+          , r_point(r_point)
+          , nlog2(nlog2)
+        {
         }
 
         //  Test whether a sphere centered at `center` with radius-squared `radius_sq` collides with any
@@ -369,6 +452,8 @@ namespace vamp::collision
         //  Returns `true` if in collision and `false` if not.
         [[nodiscard]] auto collides(const Point &center, float r) const noexcept -> bool
         {
+            // The top AABB bounds the points themselves, so it is also fattened by their radius
+            r += r_point;
             if (aabb_top.distsq_to(center) > r * r)
             {
                 return false;
@@ -383,7 +468,6 @@ namespace vamp::collision
 
             const std::size_t z = test_idx - tests.size();
 
-            r += r_point;
             const float radius_sq = r * r;
             if (aabbs[z].distsq_to(center) > radius_sq)
             {
@@ -423,6 +507,10 @@ namespace vamp::collision
         // - `radii`: SIMD vector of the radii of each sphere.
         auto collides_simd(const std::array<FVectorT, 3> &centers, FVectorT radii) const noexcept -> bool
         {
+            // NOTE: All AABBs are "point volume AABBs" - we can't just test if the query is in the AABB, but
+            // rather if it's in the AABB when fattened by the radius of the points the AABB contains
+            radii = radii + r_point;
+
             // Test against top AABB
             FVectorT inbounds =
                 (centers[0] + radii >= aabb_top.lower[0]) & (centers[0] - radii <= aabb_top.upper[0]);
@@ -454,10 +542,6 @@ namespace vamp::collision
             const IVectorT zs = idxs - tests.size();
 
             // Test whether points are in the AABBs
-            // NOTE: Now is when we need to add r_point, since these AABBs are really "point volume AABBs" -
-            // we can't just test if the query is in the AABB, but rather if it's in the AABB when fattened by
-            // the radius of the points the AABB contains
-            radii = radii + r_point;
             IVectorT zs6 = zs * 6;
             const float *const aabb_ptr = &aabbs.front().lower.front();
 
@@ -507,6 +591,26 @@ namespace vamp::collision
             return false;
         }
 
+        // The points this tree was built from. Each cell of a finite point stores that point first in its
+        // affordance buffer, and the cells of the padding points at infinity have no buffer.
+        [[nodiscard]] auto points() const -> std::vector<Point>
+        {
+            std::vector<Point> result;
+            for (std::size_t z = 0; z + 1 < aff_starts.size(); ++z)
+            {
+                const auto start = aff_starts[z];
+                if (start != aff_starts[z + 1])
+                {
+                    result.push_back(
+                        {affordances[0][start].to_array()[0],
+                         affordances[1][start].to_array()[0],
+                         affordances[2][start].to_array()[0]});
+                }
+            }
+
+            return result;
+        }
+
         auto is_valid() const noexcept -> bool
         {
             /// check relative sizing of tests / aff_starts
@@ -547,43 +651,12 @@ namespace vamp::collision
             return true;
         }
 
-        // Destroy the affordance tree, freeing all owned memory.
+        // Destroy the affordance tree, releasing its share of the buffers.
         ~CAPT() = default;
 
-        template <class T>
-        struct AlignedAllocator
-        {
-            using value_type = T;
-            inline static constexpr std::align_val_t alignment{32};
-
-            constexpr AlignedAllocator() noexcept = default;
-            constexpr AlignedAllocator(const AlignedAllocator &) noexcept = default;
-
-            template <typename U>
-            constexpr AlignedAllocator(const AlignedAllocator<U> &) noexcept
-            {
-            }
-
-            [[nodiscard]] value_type *allocate(std::size_t num_elements)
-            {
-                if (num_elements > std::numeric_limits<std::size_t>::max() / sizeof(value_type))
-                {
-                    throw std::bad_array_new_length();
-                }
-
-                const auto num_bytes = num_elements * sizeof(value_type);
-                return reinterpret_cast<value_type *>(::operator new[](num_bytes, alignment));
-            }
-
-            void deallocate(value_type *allocated_ptr, [[maybe_unused]] std::size_t num_allocated_bytes)
-            {
-                ::operator delete[](allocated_ptr, alignment);
-            }
-        };
-
         // The test buffer for this tree.
         // Contains (2 ^ nlog2) - 1 points.
-        std::vector<float, AlignedAllocator<float>> tests;
+        SharedBuffer<float> tests;
 
         //  Indexes for the starts of each affordance buffer in `affordances` for the corresponding
         //  point after the outcome of all the tests.
@@ -592,16 +665,16 @@ namespace vamp::collision
         //  `affordances` (in terms of the number of floats).
         //  We use `int32_t` instead of `std::size_t` so that we can use the same registers for integer
         //  operations as we do for floats.
-        std::vector<uint32_t, AlignedAllocator<uint32_t>> aff_starts;
+        SharedBuffer<uint32_t> aff_starts;
 
         // The combined affordance buffers for the entire tree.
         // At the start of each affordance buffer, we store 6 floats for the corner point of an axis-aligned
         // bounding box. Contains `aff_starts[2 ^ nlog2]` points, or `4 * aff_starts[2 ^ nlog2] + 6 * 2 ^
         // nlog2` float values.
-        std::array<std::vector<FVectorT>, 3> affordances;
+        std::array<SharedBuffer<FVectorT>, 3> affordances;
 
         // Axis-aligned bounding boxes for the set of afforded points in each cell.
-        std::vector<Volume> aabbs;
+        SharedBuffer<Volume> aabbs;
 
         // The AABB containing all points.
         Volume aabb_top;
@@ -3,27 +3,117 @@
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <optional>
+#include <string>
 #include <vamp/collision/shapes.hh>
 #include <vamp/collision/capt.hh>
+#include <vamp/collision/pointcloud_bvh.hh>
+#include <vamp/collision/tiled_heightfield.hh>
 #include <vamp/collision/attachments.hh>
 
 namespace vamp::collision
 {
+    // The primitives of an environment that one link of a robot can reach
+    struct LinkPrimitives
+    {
+        std::vector<Sphere<float>> spheres;
+        std::vector<Capsule<float>> capsules;
+        std::vector<Capsule<float>> z_aligned_capsules;
+        std::vector<Cylinder<float>> cylinders;
+        std::vector<Cuboid<float>> cuboids;
+        std::vector<Cuboid<float>> z_aligned_cuboids;
+    };
+
+    // Per-link subsets of the primitives of an environment, built for a robot by
+    // vamp::robots::compile_environment(). The reach of each link depends on the bounds of the robot's
+    // configuration space, so the subsets record the bounds they were built for, and only hold for instances
+    // of the robot within them. They are immutable once built and shared by every conversion of the
+    // environment.
+    struct CompiledLinks
+    {
+        using Check = bool (*)(const CompiledLinks &);
+
+        std::string robot;
+        std::vector<float> lows;
+        std::vector<float> highs;
+        std::vector<LinkPrimitives> links;
+
+        // Whether the instance of the robot bound to the calling thread lies within `lows` and `highs`
+        Check within_bounds = nullptr;
+
+        [[nodiscard]] inline auto current() const -> bool
+        {
+            return within_bounds != nullptr and within_bounds(*this);
+        }
+
+        // Whether the subsets were compiled for `Robot` and hold for its instance bound to the calling thread
+        template <typename Robot>
+        [[nodiscard]] inline auto current_for() const -> bool
+        {
+            return robot == Robot::name and links.size() == Robot::n_links and current();
+        }
+
+        // Checks by robot name, so that subsets read back from shared memory can find theirs
+        inline static void register_check(const std::string &robot, Check check)
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex());
+            registry()[robot] = check;
+        }
+
+        [[nodiscard]] inline static auto find_check(const std::string &robot) -> Check
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex());
+            const auto it = registry().find(robot);
+            return (it != registry().end()) ? it->second : nullptr;
+        }
+
+    private:
+        inline static auto registry() -> std::map<std::string, Check> &
+        {
+            static std::map<std::string, Check> checks;
+            return checks;
+        }
+
+        inline static auto registry_mutex() -> std::mutex &
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+    };
+
     template <typename DataT>
     struct Environment
     {
-        std::vector<Sphere<DataT>> spheres;
-        std::vector<Capsule<DataT>> capsules;
-        std::vector<Capsule<DataT>> z_aligned_capsules;
-        std::vector<Cylinder<DataT>> cylinders;
-        std::vector<Cuboid<DataT>> cuboids;
-        std::vector<Cuboid<DataT>> z_aligned_cuboids;
+        // Primitives keep scalar fields whatever the data type of the environment, and the collision kernels
+        // broadcast each field as they load it. Replicating every field across the lanes of a vector would
+        // multiply the memory a check streams through by the vector width, for no additional information.
+        using PrimitiveDataT = float;
+
+        std::vector<Sphere<PrimitiveDataT>> spheres;
+        std::vector<Capsule<PrimitiveDataT>> capsules;
+        std::vector<Capsule<PrimitiveDataT>> z_aligned_capsules;
+        std::vector<Cylinder<PrimitiveDataT>> cylinders;
+        std::vector<Cuboid<PrimitiveDataT>> cuboids;
+        std::vector<Cuboid<PrimitiveDataT>> z_aligned_cuboids;
         std::vector<HeightField<DataT>> heightfields;
+        std::vector<TiledHeightField> tiled_heightfields;
         std::vector<CAPT> pointclouds;
         std::optional<Attachment<DataT>> attachments;
 
+        // Per-link subsets of the primitives, built by vamp::robots::compile_environment(). Heightfields and
+        // pointclouds are never split and are always checked from the environment itself. Conversions drop
+        // the subsets, unless made with for_robot() by the robot that they were compiled for.
+        std::shared_ptr<const CompiledLinks> links;
+
+        // Hierarchy over the bounds of the pointclouds, built when the environment is converted or sorted.
+        // Anything that adds, removes, or replaces pointclouds must rebuild it, or clear() it so that they
+        // are checked one by one until the next conversion or sort().
+        PointCloudBVH pointcloud_bvh;
+
         Environment() = default;
 
         template <typename OtherDataT>
@@ -35,13 +125,34 @@ namespace vamp::collision
           , cuboids(other.cuboids.begin(), other.cuboids.end())
           , z_aligned_cuboids(other.z_aligned_cuboids.begin(), other.z_aligned_cuboids.end())
           , heightfields(other.heightfields.begin(), other.heightfields.end())
+          , tiled_heightfields(other.tiled_heightfields)
           , pointclouds(other.pointclouds.begin(), other.pointclouds.end())
           , attachments(other.template clone_attachments<DataT>())
+          , pointcloud_bvh(pointclouds)
         {
         }
 
+        // Converts an environment for checks by `Robot`. The per-link subsets are kept only if they were
+        // compiled for that robot and hold for its instance bound to the calling thread, as the kernels index
+        // them by the links of the robot checking. Any other robot checks the full primitives.
+        template <typename Robot, typename OtherDataT>
+        inline static auto for_robot(const Environment<OtherDataT> &other) -> Environment
+        {
+            Environment environment(other);
+            if (other.links and other.links->template current_for<Robot>())
+            {
+                environment.links = other.links;
+            }
+
+            return environment;
+        }
+
         inline auto sort()
         {
+            // Per-link subsets are stale once primitives change, and must be compiled again
+            links.reset();
+            pointcloud_bvh = PointCloudBVH(pointclouds);
+
             std::sort(
                 spheres.begin(),
                 spheres.end(),
@@ -0,0 +1,314 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <vamp/collision/capt.hh>
+
+namespace vamp::collision
+{
+    // Bounding volume hierarchy over the pointclouds of an environment, bounded by the CAPTs' top AABBs
+    // fattened by the radius of their points. Nodes are as wide as a vector, with the bounds of their
+    // children stored across its lanes, so each node visited is a single vectorized overlap test. A block of
+    // spheres is tested against the hierarchy once, as the AABB of all of its lanes, and only the trees whose
+    // bounds overlap it are queried, rather than descending every tree of a scene made of many clouds.
+    struct PointCloudBVH
+    {
+        using FVectorT = CAPT::FVectorT;
+        using IVectorT = CAPT::IVectorT;
+
+        static constexpr std::size_t width = FVectorT::num_scalars;
+
+        // Below this many pointclouds, testing each tree's own top AABB is as cheap as the hierarchy
+        static constexpr std::size_t min_pointclouds = 4;
+
+        struct Node
+        {
+            // Bounds of each child, one child per lane. Unused lanes have inverted bounds.
+            std::array<FVectorT, 3> lower;
+            std::array<FVectorT, 3> upper;
+
+            // Index of the node of each child, or the bitwise complement of the index of its pointcloud
+            std::array<int32_t, width> children;
+        };
+
+        PointCloudBVH() = default;
+
+        explicit PointCloudBVH(const std::vector<CAPT> &pointclouds)
+        {
+            if (pointclouds.size() < min_pointclouds)
+            {
+                return;
+            }
+
+            size = pointclouds.size();
+
+            std::vector<uint32_t> order;
+            std::vector<Volume> bounds(pointclouds.size());
+            for (auto i = 0U; i < pointclouds.size(); ++i)
+            {
+                const auto &pc = pointclouds[i];
+
+                // Trees without any finite points have inverted bounds and can never collide
+                if (pc.aabb_top.lower[0] > pc.aabb_top.upper[0])
+                {
+                    continue;
+                }
+
+                bounds[i] = pc.aabb_top;
+                for (auto k = 0U; k < 3; ++k)
+                {
+                    bounds[i].lower[k] -= pc.r_point;
+                    bounds[i].upper[k] += pc.r_point;
+                }
+
+                order.emplace_back(i);
+            }
+
+            if (not order.empty())
+            {
+                build(bounds, order.begin(), order.end());
+            }
+        }
+
+        // True if this hierarchy was built over as many pointclouds as are given, and should be used to query
+        // them. The hierarchy is not told of changes to the pointclouds it was built over, so whoever changes
+        // them must rebuild or clear it (e.g., with Environment::sort()); the count only catches pointclouds
+        // added or removed without doing so, which are then checked one by one rather than missed.
+        [[nodiscard]] inline auto indexes(const std::vector<CAPT> &pointclouds) const noexcept -> bool
+        {
+            return size != 0 and size == pointclouds.size();
+        }
+
+        // Drops the hierarchy, so that the pointclouds are checked one by one until it is built again
+        inline void clear() noexcept
+        {
+            size = 0;
+            nodes.clear();
+        }
+
+        // Calls `f` with the index of each pointcloud whose bounds overlap the block of spheres, until it
+        // returns true. Returns whether any call did.
+        template <typename F>
+        inline auto any(const std::array<FVectorT, 3> &centers, const FVectorT &radii, const F &f)
+            const noexcept -> bool
+        {
+            if (nodes.empty())
+            {
+                return false;
+            }
+
+            std::array<FVectorT, 3> block_lower;
+            std::array<FVectorT, 3> block_upper;
+            for (auto k = 0U; k < 3; ++k)
+            {
+                const auto lower = (centers[k] - radii).to_array();
+                const auto upper = (centers[k] + radii).to_array();
+                block_lower[k] = FVectorT::fill(*std::min_element(lower.cbegin(), lower.cend()));
+                block_upper[k] = FVectorT::fill(*std::max_element(upper.cbegin(), upper.cend()));
+            }
+
+            // Each level of the tree adds at most `width` entries, and nodes split their pointclouds evenly
+            std::array<int32_t, 128> stack;
+            std::size_t top = 0;
+            stack[top++] = 0;
+
+            while (top != 0)
+            {
+                const auto &node = nodes[stack[--top]];
+
+                auto overlap = (node.lower[0] <= block_upper[0]) & (block_lower[0] <= node.upper[0]);
+                for (auto k = 1U; k < 3; ++k)
+                {
+                    overlap = overlap & (node.lower[k] <= block_upper[k]) & (block_lower[k] <= node.upper[k]);
+                }
+
+                if (overlap.none())
+                {
+                    continue;
+                }
+
+                const auto lanes = overlap.template as<IVectorT>().to_array();
+                for (auto j = 0U; j < width; ++j)
+                {
+                    if (lanes[j] == 0)
+                    {
+                        continue;
+                    }
+
+                    const auto child = node.children[j];
+                    if (child >= 0)
+                    {
+                        stack[top++] = child;
+                    }
+                    else if (f(static_cast<std::size_t>(~child)))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        using Iterator = std::vector<uint32_t>::iterator;
+
+        // Builds the node over the pointclouds in [begin, end), whose children split them into `width`
+        // groups of equal size by repeated median splits along the longest axis of their centers
+        inline auto build(const std::vector<Volume> &bounds, Iterator begin, Iterator end) -> int32_t
+        {
+            const auto index = static_cast<int32_t>(nodes.size());
+            nodes.emplace_back();
+
+            std::vector<std::pair<Iterator, Iterator>> groups;
+            split(bounds, begin, end, width, groups);
+
+            std::array<std::array<float, width>, 3> lower;
+            std::array<std::array<float, width>, 3> upper;
+            std::array<int32_t, width> children;
+            for (auto k = 0U; k < 3; ++k)
+            {
+                lower[k].fill(std::numeric_limits<float>::infinity());
+                upper[k].fill(-std::numeric_limits<float>::infinity());
+            }
+
+            children.fill(0);
+
+            for (auto j = 0U; j < groups.size(); ++j)
+            {
+                const auto [first, last] = groups[j];
+
+                Volume group = bounds[*first];
+                for (auto it = first; it != last; ++it)
+                {
+                    group.extend(bounds[*it].lower);
+                    group.extend(bounds[*it].upper);
+                }
+
+                for (auto k = 0U; k < 3; ++k)
+                {
+                    lower[k][j] = group.lower[k];
+                    upper[k][j] = group.upper[k];
+                }
+
+                children[j] =
+                    (last - first == 1) ? ~static_cast<int32_t>(*first) : build(bounds, first, last);
+            }
+
+            auto &node = nodes[index];
+            for (auto k = 0U; k < 3; ++k)
+            {
+                node.lower[k] = FVectorT(lower[k]);
+                node.upper[k] = FVectorT(upper[k]);
+            }
+
+            node.children = children;
+            return index;
+        }
+
+        inline static void split(
+            const std::vector<Volume> &bounds,
+            Iterator begin,
+            Iterator end,
+            std::size_t parts,
+            std::vector<std::pair<Iterator, Iterator>> &groups)
+        {
+            if (parts == 1 or end - begin <= 1)
+            {
+                groups.emplace_back(begin, end);
+                return;
+            }
+
+            Volume centers = {center(bounds[*begin]), center(bounds[*begin])};
+            for (auto it = begin + 1; it != end; ++it)
+            {
+                centers.extend(center(bounds[*it]));
+            }
+
+            auto axis = 0U;
+            for (auto k = 1U; k < 3; ++k)
+            {
+                if (centers.upper[k] - centers.lower[k] > centers.upper[axis] - centers.lower[axis])
+                {
+                    axis = k;
+                }
+            }
+
+            const auto middle = begin + (end - begin) / 2;
+            std::nth_element(
+                begin,
+                middle,
+                end,
+                [&bounds, axis](uint32_t a, uint32_t b)
+                { return center(bounds[a])[axis] < center(bounds[b])[axis]; });
+
+            split(bounds, begin, middle, parts / 2, groups);
+            split(bounds, middle, end, parts / 2, groups);
+        }
+
+        inline static auto center(const Volume &v) noexcept -> Point
+        {
+            return {
+                0.5F * (v.lower[0] + v.upper[0]),
+                0.5F * (v.lower[1] + v.upper[1]),
+                0.5F * (v.lower[2] + v.upper[2])};
+        }
+
+        // Number of pointclouds the hierarchy was built over, or zero if it was not built
+        std::size_t size = 0;
+        std::vector<Node> nodes;
+    };
+
+    // Merges the pointclouds with at most `max_points` points into shared trees, one for each distinct set of
+    // radii that they were built with, since a tree is only valid for the radii it was built for. Scenes made
+    // of many small clouds (e.g., one per segmented object) otherwise pay for a tree descent per cloud. The
+    // order of the pointclouds is not preserved.
+    inline void merge_pointclouds(std::vector<CAPT> &pointclouds, std::size_t max_points)
+    {
+        using Radii = std::tuple<float, float, float>;
+
+        std::vector<CAPT> kept;
+        std::map<Radii, std::vector<std::size_t>> groups;
+        std::vector<std::vector<Point>> points(pointclouds.size());
+        for (auto i = 0U; i < pointclouds.size(); ++i)
+        {
+            points[i] = pointclouds[i].points();
+            if (points[i].size() <= max_points)
+            {
+                const auto &pc = pointclouds[i];
+                groups[{pc.r_min, pc.r_max, pc.r_point}].emplace_back(i);
+            }
+            else
+            {
+                kept.emplace_back(std::move(pointclouds[i]));
+            }
+        }
+
+        for (const auto &[radii, members] : groups)
+        {
+            if (members.size() == 1)
+            {
+                kept.emplace_back(std::move(pointclouds[members.front()]));
+                continue;
+            }
+
+            std::vector<Point> merged;
+            for (const auto i : members)
+            {
+                merged.insert(merged.end(), points[i].cbegin(), points[i].cend());
+            }
+
+            const auto &[r_min, r_max, r_point] = radii;
+            kept.emplace_back(merged, r_min, r_max, r_point);
+        }
+
+        pointclouds = std::move(kept);
+    }
+}  // namespace vamp::collision
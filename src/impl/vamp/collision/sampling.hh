@@ -0,0 +1,275 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/math.hh>
+#include <vamp/collision/shapes.hh>
+#include <vamp/random/uniform.hh>
+#include <vamp/thread_pool.hh>
+#include <vamp/vector.hh>
+
+// Samples synthetic pointclouds from the surfaces of an environment's primitives, e.g., to benchmark planning
+// against pointclouds of scenes that are described by primitives. Points are generated a vector at a time,
+// and objects are sampled in parallel, each from its own random stream so the result does not depend on the
+// number of threads.
+namespace vamp::collision::sampling
+{
+    using Vector = FloatVector<>;
+    using rng::UniformStream;
+    static constexpr const float PI = 3.14159265359F;
+
+    // Uniformly distributed unit vectors
+    inline auto direction(UniformStream &rng) noexcept -> std::array<Vector, 3>
+    {
+        const auto z = rng.next() * 2.F - 1.F;
+        const auto phi = rng.next() * (2.F * PI) - PI;
+        const auto r = (1.F - z * z).clamp(0.F, 1.F).sqrt();
+        return {r * phi.cos(), r * phi.sin(), z};
+    }
+
+    // Writes the lanes of a block of points into `out`, stopping at `end`
+    inline void write(const std::array<Vector, 3> &p, Point *out, const Point *end) noexcept
+    {
+        std::array<std::array<float, FloatVectorWidth>, 3> lanes;
+        for (auto j = 0U; j < 3; ++j)
+        {
+            p[j].to_array(lanes[j].data());
+        }
+
+        for (auto i = 0U; i < FloatVectorWidth and out + i < end; ++i)
+        {
+            out[i] = {lanes[0][i], lanes[1][i], lanes[2][i]};
+        }
+    }
+
+    // Samples `n` points by drawing vectors of points from `f`, adding uniform noise in [-noise, noise]
+    template <typename F>
+    inline void sample(UniformStream &rng, std::size_t n, float noise, Point *out, const F &f) noexcept
+    {
+        const auto *end = out + n;
+        for (; out < end; out += FloatVectorWidth)
+        {
+            auto p = f();
+            if (noise > 0.F)
+            {
+                for (auto &c : p)
+                {
+                    c = c + (rng.next() * 2.F - 1.F) * noise;
+                }
+            }
+
+            write(p, out, end);
+        }
+    }
+
+    inline void sphere(const Sphere<float> &s, UniformStream &rng, std::size_t n, float noise, Point *out)
+    {
+        sample(
+            rng,
+            n,
+            noise,
+            out,
+            [&]()
+            {
+                const auto [dx, dy, dz] = direction(rng);
+                return std::array<Vector, 3>{s.x + dx * s.r, s.y + dy * s.r, s.z + dz * s.r};
+            });
+    }
+
+    inline void cuboid(const Cuboid<float> &c, UniformStream &rng, std::size_t n, float noise, Point *out)
+    {
+        // Pairs of faces are picked by their area, then the coordinate along the picked axis is snapped to
+        // one of its faces
+        const auto a1 = c.axis_2_r * c.axis_3_r;
+        const auto a2 = c.axis_1_r * c.axis_3_r;
+        const auto a3 = c.axis_1_r * c.axis_2_r;
+        const auto total = a1 + a2 + a3;
+
+        sample(
+            rng,
+            n,
+            noise,
+            out,
+            [&]()
+            {
+                const auto face = rng.next() * total;
+                const auto u1 = rng.next() * 2.F - 1.F;
+                const auto u2 = rng.next() * 2.F - 1.F;
+                const auto u3 = rng.next() * 2.F - 1.F;
+
+                const auto on_1 = face < Vector::fill(a1);
+                const auto on_2 = (face < Vector::fill(a1 + a2)) & ~on_1;
+                const auto on_3 = ~(on_1 | on_2);
+
+                const auto snap = [](const Vector &u, const Vector &mask)
+                { return u.blend(((u >= 0.F) & 2.F) - 1.F, mask); };
+
+                const auto d1 = snap(u1, on_1) * c.axis_1_r;
+                const auto d2 = snap(u2, on_2) * c.axis_2_r;
+                const auto d3 = snap(u3, on_3) * c.axis_3_r;
+
+                return std::array<Vector, 3>{
+                    c.x + d1 * c.axis_1_x + d2 * c.axis_2_x + d3 * c.axis_3_x,
+                    c.y + d1 * c.axis_1_y + d2 * c.axis_2_y + d3 * c.axis_3_y,
+                    c.z + d1 * c.axis_1_z + d2 * c.axis_2_z + d3 * c.axis_3_z};
+            });
+    }
+
+    // Samples a cylinder with flat caps, or a capsule with hemispherical caps
+    inline void cylinder(
+        const Cylinder<float> &c,
+        bool capsule,
+        UniformStream &rng,
+        std::size_t n,
+        float noise,
+        Point *out)
+    {
+        const auto length = std::sqrt(dot_3(c.xv, c.yv, c.zv, c.xv, c.yv, c.zv));
+        const std::array<float, 3> axis = {c.xv / length, c.yv / length, c.zv / length};
+
+        // Orthonormal basis of the plane perpendicular to the axis
+        const auto pivot = (std::abs(axis[0]) < 0.9F) ? std::array<float, 3>{1.F, 0.F, 0.F} :
+                                                        std::array<float, 3>{0.F, 1.F, 0.F};
+        auto e1 = std::array<float, 3>{
+            axis[1] * pivot[2] - axis[2] * pivot[1],
+            axis[2] * pivot[0] - axis[0] * pivot[2],
+            axis[0] * pivot[1] - axis[1] * pivot[0]};
+        const auto e1_length = std::sqrt(dot_3(e1[0], e1[1], e1[2], e1[0], e1[1], e1[2]));
+        for (auto &v : e1)
+        {
+            v /= e1_length;
+        }
+
+        const std::array<float, 3> e2 = {
+            axis[1] * e1[2] - axis[2] * e1[1],
+            axis[2] * e1[0] - axis[0] * e1[2],
+            axis[0] * e1[1] - axis[1] * e1[0]};
+
+        // Areas of both caps and of the side, over 2 * PI * r
+        const auto caps = capsule ? 2.F * c.r : c.r;
+        const auto total = caps + length;
+
+        sample(
+            rng,
+            n,
+            noise,
+            out,
+            [&]()
+            {
+                const auto part = rng.next() * total;
+                const auto on_side = part < Vector::fill(length);
+
+                // On the side, a point around the axis; on the caps, a point on a disc or sphere
+                const auto phi = rng.next() * (2.F * PI) - PI;
+                const auto u = rng.next();
+                const auto t_side = u * length;
+
+                std::array<Vector, 3> p;
+                if (capsule)
+                {
+                    const auto [dx, dy, dz] = direction(rng);
+                    const auto along = dx * axis[0] + dy * axis[1] + dz * axis[2];
+                    const auto t_cap = (along >= 0.F) & length;
+
+                    const std::array<Vector, 3> side = {phi.cos() * c.r, phi.sin() * c.r, t_side};
+                    const std::array<Vector, 3> cap = {
+                        (dx * e1[0] + dy * e1[1] + dz * e1[2]) * c.r,
+                        (dx * e2[0] + dy * e2[1] + dz * e2[2]) * c.r,
+                        t_cap + along * c.r};
+                    for (auto j = 0U; j < 3; ++j)
+                    {
+                        p[j] = cap[j].blend(side[j], on_side);
+                    }
+                }
+                else
+                {
+                    // Uniform over the area of the discs
+                    const auto radial = (u.clamp(0.F, 1.F).sqrt() * c.r).blend(Vector::fill(c.r), on_side);
+                    const auto t_cap = (part >= (length + 0.5F * c.r)) & length;
+                    p = {phi.cos() * radial, phi.sin() * radial, t_cap.blend(t_side, on_side)};
+                }
+
+                const auto &[a, b, t] = p;
+                return std::array<Vector, 3>{
+                    c.x1 + a * e1[0] + b * e2[0] + t * axis[0],
+                    c.y1 + a * e1[1] + b * e2[1] + t * axis[1],
+                    c.z1 + a * e1[2] + b * e2[2] + t * axis[2]};
+            });
+    }
+
+    // Samples `n` points from the surface of every sphere, cuboid, cylinder, and capsule in an environment,
+    // in that order, with `n` consecutive points per object. Other primitives are ignored. If `flat_caps`,
+    // capsules are sampled as cylinders, as capsules often stand in for cylinders (e.g., in MBM problems).
+    inline auto sample_surfaces(
+        const Environment<float> &environment,
+        std::size_t n,
+        float noise = 0.F,
+        std::uint64_t seed = 0,
+        bool flat_caps = false,
+        std::size_t n_threads = std::thread::hardware_concurrency()) -> std::vector<Point>
+    {
+        const std::array<std::size_t, 6> counts = {
+            environment.spheres.size(),
+            environment.cuboids.size(),
+            environment.z_aligned_cuboids.size(),
+            environment.cylinders.size(),
+            environment.capsules.size(),
+            environment.z_aligned_capsules.size()};
+
+        std::size_t n_objects = 0;
+        for (const auto count : counts)
+        {
+            n_objects += count;
+        }
+
+        std::vector<Point> points(n_objects * n);
+        utils::parallel_for(
+            n_threads,
+            n_objects,
+            [&](std::size_t object)
+            {
+                UniformStream rng(seed + 1, object + 1);
+                auto *out = points.data() + object * n;
+
+                auto i = object;
+                if (i < counts[0])
+                {
+                    return sphere(environment.spheres[i], rng, n, noise, out);
+                }
+
+                i -= counts[0];
+                if (i < counts[1])
+                {
+                    return cuboid(environment.cuboids[i], rng, n, noise, out);
+                }
+
+                i -= counts[1];
+                if (i < counts[2])
+                {
+                    return cuboid(environment.z_aligned_cuboids[i], rng, n, noise, out);
+                }
+
+                i -= counts[2];
+                if (i < counts[3])
+                {
+                    return cylinder(environment.cylinders[i], false, rng, n, noise, out);
+                }
+
+                i -= counts[3];
+                if (i < counts[4])
+                {
+                    return cylinder(environment.capsules[i], not flat_caps, rng, n, noise, out);
+                }
+
+                i -= counts[4];
+                cylinder(environment.z_aligned_capsules[i], not flat_caps, rng, n, noise, out);
+            });
+
+        return points;
+    }
+}  // namespace vamp::collision::sampling
@@ -2,8 +2,10 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <vamp/vector.hh>
+#include <vamp/collision/buffer.hh>
 #include <vamp/collision/math.hh>
 
 #include <Eigen/Geometry>
@@ -263,7 +265,7 @@ namespace vamp::collision
         std::size_t xd2;  // image size half
         std::size_t yd2;
 
-        std::vector<float> data;  // flattened row-major data
+        SharedBuffer<float> data;  // flattened row-major data
 
         HeightField() = default;
 
@@ -288,7 +290,34 @@ namespace vamp::collision
           , yd(yd)
           , xd2(xd / 2)
           , yd2(yd / 2)
-          , data(data)
+          , data(std::vector<float>(data))
+        {
+            Shape<DataT>::min_distance = 0;
+        }
+
+        // Heightfield over existing data, e.g., a view into shared memory
+        explicit HeightField(
+            DataT x,
+            DataT y,
+            DataT z,
+            DataT xs,
+            DataT ys,
+            DataT zs,
+            std::size_t xd,
+            std::size_t yd,
+            SharedBuffer<float> data)
+          : Shape<DataT>()
+          , x(x)
+          , y(y)
+          , z(z)
+          , xs(xs)
+          , ys(ys)
+          , zs(zs)
+          , xd(xd)
+          , yd(yd)
+          , xd2(xd / 2)
+          , yd2(yd / 2)
+          , data(std::move(data))
         {
             Shape<DataT>::min_distance = 0;
         }
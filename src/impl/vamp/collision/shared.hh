@@ -0,0 +1,564 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <vamp/collision/buffer.hh>
+#include <vamp/collision/capt.hh>
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/shapes.hh>
+#include <vamp/collision/tiled_heightfield.hh>
+#include <vamp/utils.hh>
+
+// Compiles an environment into a POSIX shared memory segment, so that many processes can plan in the same
+// scene without each building (and holding) their own copy of its pointclouds and heightfields.
+//
+// The segment is position independent: it is a flat stream of records that is read front to back, with
+// bulk arrays stored inline at aligned offsets, so it holds no pointers and can be mapped at any address.
+// Attaching maps the segment read-only. Primitives are small and are copied out, whereas the buffers of
+// each CAPT and heightfield are zero-copy views into the mapping, which stays mapped for as long as any
+// environment (or copy of one) refers to it.
+namespace vamp::collision::shared
+{
+    inline constexpr std::array<char, 8> magic = {'V', 'A', 'M', 'P', 'E', 'N', 'V', '\0'};
+    inline constexpr std::uint32_t version = 3;
+
+    // Alignment of every bulk array, enough for any SIMD vector width
+    inline constexpr std::size_t array_alignment = 64;
+
+    // The segment is published by storing the magic last, in one atomic word at the start of the mapping
+    using MagicWord = std::atomic<std::uint64_t>;
+    static_assert(MagicWord::is_always_lock_free);
+
+    struct Header
+    {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+
+        // CAPT affordances are stored as SIMD vectors, so a segment is only usable by builds with the same
+        // vector width
+        std::uint32_t vector_bytes;
+
+        std::uint64_t size;
+    };
+
+    // Applies `f` to each scalar field of a primitive, other than those in Shape
+    template <typename S, typename F>
+    inline void fields(S &s, F &&f)
+    {
+        using T = std::remove_const_t<S>;
+        if constexpr (std::is_same_v<T, Sphere<float>>)
+        {
+            f(s.x), f(s.y), f(s.z), f(s.r);
+        }
+        else if constexpr (std::is_same_v<T, Cylinder<float>>)
+        {
+            f(s.x1), f(s.y1), f(s.z1), f(s.xv), f(s.yv), f(s.zv), f(s.r), f(s.rdv);
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, Cuboid<float>>);
+            f(s.x), f(s.y), f(s.z);
+            f(s.axis_1_x), f(s.axis_1_y), f(s.axis_1_z);
+            f(s.axis_2_x), f(s.axis_2_y), f(s.axis_2_z);
+            f(s.axis_3_x), f(s.axis_3_y), f(s.axis_3_z);
+            f(s.axis_1_r), f(s.axis_2_r), f(s.axis_3_r);
+        }
+    }
+
+    // Appends records to a segment. Without a destination, only measures how large the segment must be.
+    class Writer
+    {
+    public:
+        explicit Writer(char *base = nullptr) noexcept : base(base)
+        {
+        }
+
+        template <typename T>
+        inline void value(const T &v)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            bytes(&v, sizeof(T), alignof(T));
+        }
+
+        inline void string(const std::string &s)
+        {
+            value<std::uint64_t>(s.size());
+            bytes(s.data(), s.size(), 1);
+        }
+
+        template <typename T>
+        inline void array(const T *data, std::size_t n)
+        {
+            value<std::uint64_t>(n);
+            bytes(data, n * sizeof(T), array_alignment);
+        }
+
+        template <typename S>
+        inline void shapes(const std::vector<S> &primitives)
+        {
+            value<std::uint64_t>(primitives.size());
+            for (const auto &s : primitives)
+            {
+                string(s.name);
+                value(s.min_distance);
+                fields(s, [this](const float &v) { value(v); });
+            }
+        }
+
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t
+        {
+            return offset;
+        }
+
+    private:
+        inline void bytes(const void *data, std::size_t n, std::size_t alignment)
+        {
+            offset = utils::round_size(offset, alignment);
+            if (base and n)
+            {
+                std::memcpy(base + offset, data, n);
+            }
+
+            offset += n;
+        }
+
+        char *base;
+        std::size_t offset = 0;
+    };
+
+    // Reads records back out of a mapped segment, in the order they were written.
+    class Reader
+    {
+    public:
+        Reader(const char *base, std::size_t size, std::shared_ptr<const void> owner) noexcept
+          : base(base), end(size), owner(std::move(owner))
+        {
+        }
+
+        template <typename T>
+        inline auto value() -> T
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T v;
+            std::memcpy(&v, bytes(sizeof(T), alignof(T)), sizeof(T));
+            return v;
+        }
+
+        inline auto string() -> std::string
+        {
+            const auto n = value<std::uint64_t>();
+            return std::string(bytes(n, 1), n);
+        }
+
+        template <typename T>
+        inline auto array() -> SharedBuffer<T>
+        {
+            const auto n = value<std::uint64_t>();
+            if (n > (end - offset) / sizeof(T))
+            {
+                throw std::runtime_error("Shared environment is truncated!");
+            }
+
+            const auto *data = reinterpret_cast<const T *>(bytes(n * sizeof(T), array_alignment));
+            return SharedBuffer<T>(data, n, owner);
+        }
+
+        template <typename S>
+        inline auto shapes() -> std::vector<S>
+        {
+            std::vector<S> primitives(value<std::uint64_t>());
+            for (auto &s : primitives)
+            {
+                s.name = string();
+                s.min_distance = value<float>();
+                fields(s, [this](float &v) { v = value<float>(); });
+            }
+
+            return primitives;
+        }
+
+    private:
+        inline auto bytes(std::size_t n, std::size_t alignment) -> const char *
+        {
+            offset = utils::round_size(offset, alignment);
+            if (offset > end or n > end - offset)
+            {
+                throw std::runtime_error("Shared environment is truncated!");
+            }
+
+            const auto *data = base + offset;
+            offset += n;
+            return data;
+        }
+
+        const char *base;
+        std::size_t end;
+        std::size_t offset = 0;
+        std::shared_ptr<const void> owner;
+    };
+
+    inline void write(Writer &w, const CAPT &pc)
+    {
+        w.value(pc.aabb_top);
+        w.value(pc.r_min);
+        w.value(pc.r_max);
+        w.value(pc.r_point);
+        w.value(pc.nlog2);
+        w.array(pc.tests.data(), pc.tests.size());
+        w.array(pc.aff_starts.data(), pc.aff_starts.size());
+        for (const auto &buffer : pc.affordances)
+        {
+            w.array(buffer.data(), buffer.size());
+        }
+        w.array(pc.aabbs.data(), pc.aabbs.size());
+    }
+
+    inline auto read_capt(Reader &r) -> CAPT
+    {
+        const auto aabb_top = r.value<Volume>();
+        const auto r_min = r.value<float>();
+        const auto r_max = r.value<float>();
+        const auto r_point = r.value<float>();
+        const auto nlog2 = r.value<uint8_t>();
+        auto tests = r.array<float>();
+        auto aff_starts = r.array<uint32_t>();
+
+        std::array<SharedBuffer<CAPT::FVectorT>, 3> affordances;
+        for (auto &buffer : affordances)
+        {
+            buffer = r.array<CAPT::FVectorT>();
+        }
+
+        auto aabbs = r.array<Volume>();
+        return CAPT(
+            std::move(tests),
+            std::move(aff_starts),
+            std::move(affordances),
+            std::move(aabbs),
+            aabb_top,
+            r_min,
+            r_max,
+            r_point,
+            nlog2);
+    }
+
+    inline void write(Writer &w, const HeightField<float> &h)
+    {
+        w.string(h.name);
+        w.value(h.x);
+        w.value(h.y);
+        w.value(h.z);
+        w.value(h.xs);
+        w.value(h.ys);
+        w.value(h.zs);
+        w.value<std::uint64_t>(h.xd);
+        w.value<std::uint64_t>(h.yd);
+        w.array(h.data.data(), h.data.size());
+    }
+
+    inline auto read_heightfield(Reader &r) -> HeightField<float>
+    {
+        auto name = r.string();
+        const auto x = r.value<float>();
+        const auto y = r.value<float>();
+        const auto z = r.value<float>();
+        const auto xs = r.value<float>();
+        const auto ys = r.value<float>();
+        const auto zs = r.value<float>();
+        const auto xd = r.value<std::uint64_t>();
+        const auto yd = r.value<std::uint64_t>();
+
+        HeightField<float> h(x, y, z, xs, ys, zs, xd, yd, r.array<float>());
+        h.name = std::move(name);
+        return h;
+    }
+
+    inline void write(Writer &w, const CompiledLinks &c)
+    {
+        w.string(c.robot);
+        w.array(c.lows.data(), c.lows.size());
+        w.array(c.highs.data(), c.highs.size());
+
+        w.value<std::uint64_t>(c.links.size());
+        for (const auto &link : c.links)
+        {
+            w.shapes(link.spheres);
+            w.shapes(link.capsules);
+            w.shapes(link.z_aligned_capsules);
+            w.shapes(link.cylinders);
+            w.shapes(link.cuboids);
+            w.shapes(link.z_aligned_cuboids);
+        }
+    }
+
+    // Per-link subsets are only kept if this process knows how to check the bounds of their robot, which
+    // it does once it has compiled an environment for the robot or loaded its bindings
+    inline auto read_links(Reader &r) -> std::shared_ptr<const CompiledLinks>
+    {
+        auto c = std::make_shared<CompiledLinks>();
+        c->robot = r.string();
+
+        const auto lows = r.array<float>();
+        const auto highs = r.array<float>();
+        c->lows.assign(lows.begin(), lows.end());
+        c->highs.assign(highs.begin(), highs.end());
+
+        c->links.resize(r.value<std::uint64_t>());
+        for (auto &link : c->links)
+        {
+            link.spheres = r.shapes<Sphere<float>>();
+            link.capsules = r.shapes<Capsule<float>>();
+            link.z_aligned_capsules = r.shapes<Capsule<float>>();
+            link.cylinders = r.shapes<Cylinder<float>>();
+            link.cuboids = r.shapes<Cuboid<float>>();
+            link.z_aligned_cuboids = r.shapes<Cuboid<float>>();
+        }
+
+        c->within_bounds = CompiledLinks::find_check(c->robot);
+        if (not c->within_bounds)
+        {
+            return nullptr;
+        }
+
+        return c;
+    }
+
+    inline void write(Writer &w, const Environment<float> &e)
+    {
+        w.shapes(e.spheres);
+        w.shapes(e.capsules);
+        w.shapes(e.z_aligned_capsules);
+        w.shapes(e.cylinders);
+        w.shapes(e.cuboids);
+        w.shapes(e.z_aligned_cuboids);
+
+        w.value<std::uint64_t>(e.heightfields.size());
+        for (const auto &h : e.heightfields)
+        {
+            write(w, h);
+        }
+
+        // Tiled heightfields are already mapped from files, which each process maps for itself
+        w.value<std::uint64_t>(e.tiled_heightfields.size());
+        for (const auto &t : e.tiled_heightfields)
+        {
+            w.string(t.filename);
+        }
+
+        w.value<std::uint64_t>(e.pointclouds.size());
+        for (const auto &pc : e.pointclouds)
+        {
+            write(w, pc);
+        }
+
+        w.value<std::uint8_t>(e.attachments.has_value());
+        if (e.attachments)
+        {
+            w.array(e.attachments->tf.matrix().data(), 16);
+            w.shapes(e.attachments->spheres);
+        }
+
+        w.value<std::uint8_t>(e.links != nullptr);
+        if (e.links)
+        {
+            write(w, *e.links);
+        }
+    }
+
+    inline auto read_environment(Reader &r) -> Environment<float>
+    {
+        Environment<float> e;
+        e.spheres = r.shapes<Sphere<float>>();
+        e.capsules = r.shapes<Capsule<float>>();
+        e.z_aligned_capsules = r.shapes<Capsule<float>>();
+        e.cylinders = r.shapes<Cylinder<float>>();
+        e.cuboids = r.shapes<Cuboid<float>>();
+        e.z_aligned_cuboids = r.shapes<Cuboid<float>>();
+
+        const auto n_heightfields = r.value<std::uint64_t>();
+        for (auto i = 0U; i < n_heightfields; ++i)
+        {
+            e.heightfields.emplace_back(read_heightfield(r));
+        }
+
+        const auto n_tiled_heightfields = r.value<std::uint64_t>();
+        for (auto i = 0U; i < n_tiled_heightfields; ++i)
+        {
+            e.tiled_heightfields.emplace_back(TiledHeightField::open(r.string()));
+        }
+
+        const auto n_pointclouds = r.value<std::uint64_t>();
+        for (auto i = 0U; i < n_pointclouds; ++i)
+        {
+            e.pointclouds.emplace_back(read_capt(r));
+        }
+
+        e.pointcloud_bvh = PointCloudBVH(e.pointclouds);
+
+        if (r.value<std::uint8_t>())
+        {
+            const auto matrix = r.array<float>();
+            Eigen::Isometry3f tf;
+            std::copy(matrix.begin(), matrix.end(), tf.matrix().data());
+
+            e.attachments.emplace(tf);
+            e.attachments->spheres = r.shapes<Sphere<float>>();
+        }
+
+        if (r.value<std::uint8_t>())
+        {
+            e.links = read_links(r);
+        }
+
+        return e;
+    }
+
+    // Compiles an environment into a new shared memory segment called `name` (e.g., "/scene"), returning the
+    // size of the segment in bytes. The segment persists until it is unlinked, even after this process exits.
+    //
+    // The name is visible as soon as the segment is created, before it is sized and filled, and POSIX shared
+    // memory has no way to rename a segment into place once it is complete. Instead, the segment is filled
+    // with its magic left zeroed, and the magic is stored last, with release ordering, to publish it. A
+    // process that attaches before then gets an error that the segment is still being created, rather than
+    // reading a partial environment, and must retry. If this process dies before publishing, the name is left
+    // holding a segment that is never published, and must be unlinked.
+    inline auto create(const Environment<float> &e, const std::string &name) -> std::size_t
+    {
+        Writer measure;
+        measure.value(Header{});
+        write(measure, e);
+
+        const auto size = measure.size();
+
+        const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0)
+        {
+            throw std::runtime_error(
+                "Failed to create shared environment " + name + ": " + std::strerror(errno));
+        }
+
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            const auto error = errno;
+            close(fd);
+            shm_unlink(name.c_str());
+            throw std::runtime_error(
+                "Failed to size shared environment " + name + ": " + std::strerror(error));
+        }
+
+        void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (memory == MAP_FAILED)
+        {
+            const auto error = errno;
+            shm_unlink(name.c_str());
+            throw std::runtime_error(
+                "Failed to map shared environment " + name + ": " + std::strerror(error));
+        }
+
+        Writer w(static_cast<char *>(memory));
+        w.value(Header{{}, version, sizeof(CAPT::FVectorT), size});
+        write(w, e);
+
+        std::uint64_t word;
+        std::memcpy(&word, magic.data(), sizeof(word));
+        reinterpret_cast<MagicWord *>(memory)->store(word, std::memory_order_release);
+
+        munmap(memory, size);
+        return size;
+    }
+
+    // Maps the shared memory segment called `name` read-only. The buffers of the returned environment's
+    // pointclouds and heightfields point into the mapping.
+    inline auto attach(const std::string &name) -> Environment<float>
+    {
+        const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0)
+        {
+            throw std::runtime_error(
+                "Failed to open shared environment " + name + ": " + std::strerror(errno));
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            const auto error = errno;
+            close(fd);
+            throw std::runtime_error(
+                "Failed to stat shared environment " + name + ": " + std::strerror(error));
+        }
+
+        // Not yet sized by the process creating it
+        const auto size = static_cast<std::size_t>(info.st_size);
+        if (size < sizeof(Header))
+        {
+            close(fd);
+            throw std::runtime_error("Shared environment " + name + " is still being created!");
+        }
+
+        void *memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (memory == MAP_FAILED)
+        {
+            throw std::runtime_error(
+                "Failed to map shared environment " + name + ": " + std::strerror(errno));
+        }
+
+        std::shared_ptr<const void> mapping(
+            memory, [size](const void *p) { munmap(const_cast<void *>(p), size); });
+
+        // Everything written before the magic is visible once it is
+        const auto word = reinterpret_cast<const MagicWord *>(memory)->load(std::memory_order_acquire);
+        if (word == 0)
+        {
+            throw std::runtime_error("Shared environment " + name + " is still being created!");
+        }
+
+        Reader r(static_cast<const char *>(memory), size, mapping);
+        auto header = r.value<Header>();
+        std::memcpy(header.magic.data(), &word, sizeof(word));
+        if (header.magic != magic or header.version != version)
+        {
+            throw std::runtime_error("Shared memory segment " + name + " is not a shared environment!");
+        }
+
+        if (header.vector_bytes != sizeof(CAPT::FVectorT))
+        {
+            throw std::runtime_error(
+                "Shared environment " + name + " was compiled for a different SIMD vector width!");
+        }
+
+        if (header.size != size)
+        {
+            throw std::runtime_error("Shared environment " + name + " is truncated!");
+        }
+
+        return read_environment(r);
+    }
+
+    // Removes the name of a shared memory segment. Processes already attached keep their mapping.
+    inline void unlink(const std::string &name)
+    {
+        if (shm_unlink(name.c_str()) != 0)
+        {
+            throw std::runtime_error(
+                "Failed to unlink shared environment " + name + ": " + std::strerror(errno));
+        }
+    }
+}  // namespace vamp::collision::shared
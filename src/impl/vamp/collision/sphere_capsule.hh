@@ -5,18 +5,19 @@
 
 namespace vamp::collision
 {
-    template <typename DataT>
+    // Capsules may store scalar fields, which are broadcast to the query's data type as they are loaded
+    template <typename DataT, typename PrimitiveDataT>
     inline constexpr auto sphere_capsule(
-        const Capsule<DataT> &c,
+        const Capsule<PrimitiveDataT> &c,
         const DataT &x,
         const DataT &y,
         const DataT &z,
         const DataT &r) noexcept -> DataT
     {
-        auto dot = dot_3(x - c.x1, y - c.y1, z - c.z1, c.xv, c.yv, c.zv);
+        auto dot = dot_3<DataT>(x - c.x1, y - c.y1, z - c.z1, c.xv, c.yv, c.zv);
         auto cdf = (dot * c.rdv).clamp(0.F, 1.F);
 
-        auto sum = sql2_3(x, y, z, c.x1 + c.xv * cdf, c.y1 + c.yv * cdf, c.z1 + c.zv * cdf);
+        auto sum = sql2_3<DataT>(x, y, z, c.x1 + c.xv * cdf, c.y1 + c.yv * cdf, c.z1 + c.zv * cdf);
         auto rs = r + c.r;
         return sum - rs * rs;
     }
@@ -27,9 +28,9 @@ namespace vamp::collision
         return sphere_capsule(c, s.x, s.y, s.z, s.r);
     }
 
-    template <typename DataT>
+    template <typename DataT, typename PrimitiveDataT>
     inline constexpr auto sphere_z_aligned_capsule(
-        const Capsule<DataT> &c,
+        const Capsule<PrimitiveDataT> &c,
         const DataT &x,
         const DataT &y,
         const DataT &z,
@@ -38,7 +39,7 @@ namespace vamp::collision
         auto dot = (z - c.z1) * c.zv;
         auto cdf = (dot * c.rdv).clamp(0.F, 1.F);
 
-        auto sum = sql2_3(x, y, z, c.x1, c.y1, c.z1 + c.zv * cdf);
+        auto sum = sql2_3<DataT>(x, y, z, c.x1, c.y1, c.z1 + c.zv * cdf);
         auto rs = r + c.r;
         return sum - rs * rs;
     }
@@ -5,9 +5,10 @@
 
 namespace vamp::collision
 {
-    template <typename DataT>
+    // Cuboids may store scalar fields, which are broadcast to the query's data type as they are loaded
+    template <typename DataT, typename PrimitiveDataT>
     inline constexpr auto sphere_cuboid(
-        const Cuboid<DataT> &c,
+        const Cuboid<PrimitiveDataT> &c,
         const DataT &x,
         const DataT &y,
         const DataT &z,
@@ -17,9 +18,9 @@ namespace vamp::collision
         auto ys = y - c.y;
         auto zs = z - c.z;
 
-        auto a1 = (dot_3(c.axis_1_x, c.axis_1_y, c.axis_1_z, xs, ys, zs).abs() - c.axis_1_r).max(0.);
-        auto a2 = (dot_3(c.axis_2_x, c.axis_2_y, c.axis_2_z, xs, ys, zs).abs() - c.axis_2_r).max(0.);
-        auto a3 = (dot_3(c.axis_3_x, c.axis_3_y, c.axis_3_z, xs, ys, zs).abs() - c.axis_3_r).max(0.);
+        auto a1 = (dot_3<DataT>(c.axis_1_x, c.axis_1_y, c.axis_1_z, xs, ys, zs).abs() - c.axis_1_r).max(0.);
+        auto a2 = (dot_3<DataT>(c.axis_2_x, c.axis_2_y, c.axis_2_z, xs, ys, zs).abs() - c.axis_2_r).max(0.);
+        auto a3 = (dot_3<DataT>(c.axis_3_x, c.axis_3_y, c.axis_3_z, xs, ys, zs).abs() - c.axis_3_r).max(0.);
 
         auto sum = dot_3(a1, a2, a3, a1, a2, a3);
         return sum - rsq;
@@ -31,9 +32,9 @@ namespace vamp::collision
         return sphere_cuboid(c, s.x, s.y, s.z, s.r * s.r);
     }
 
-    template <typename DataT>
+    template <typename DataT, typename PrimitiveDataT>
     inline constexpr auto sphere_z_aligned_cuboid(
-        const Cuboid<DataT> &c,
+        const Cuboid<PrimitiveDataT> &c,
         const DataT &x,
         const DataT &y,
         const DataT &z,
@@ -43,8 +44,8 @@ namespace vamp::collision
         auto ys = y - c.y;
         auto zs = z - c.z;
 
-        auto a1 = (dot_2(c.axis_1_x, c.axis_1_y, xs, ys).abs() - c.axis_1_r).max(0.);
-        auto a2 = (dot_2(c.axis_2_x, c.axis_2_y, xs, ys).abs() - c.axis_2_r).max(0.);
+        auto a1 = (dot_2<DataT>(c.axis_1_x, c.axis_1_y, xs, ys).abs() - c.axis_1_r).max(0.);
+        auto a2 = (dot_2<DataT>(c.axis_2_x, c.axis_2_y, xs, ys).abs() - c.axis_2_r).max(0.);
         auto a3 = (zs.abs() - c.axis_3_r).max(0.);
 
         auto sum = dot_3(a1, a2, a3, a1, a2, a3);
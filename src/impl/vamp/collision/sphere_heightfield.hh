@@ -2,6 +2,7 @@
 
 #include <vamp/collision/shapes.hh>
 #include <vamp/collision/math.hh>
+#include <vamp/collision/tiled_heightfield.hh>
 
 namespace vamp::collision
 {
@@ -28,4 +29,49 @@ namespace vamp::collision
 
         return z - r - zhs;
     }
+
+    // Negative in the lanes whose sphere is below the terrain. Heights are only gathered for the lanes that
+    // lie between the bounds of their tile, so tiles that no sphere comes close to are never read.
+    template <typename DataT>
+    inline constexpr auto sphere_tiled_heightfield(
+        const TiledHeightField &a,
+        const DataT &x,
+        const DataT &y,
+        const DataT &z,
+        const DataT &r) noexcept -> DataT
+    {
+        using IndexT = IntVector<DataT::num_scalars_per_row, DataT::num_rows>;
+        const auto lowest = z - r - a.origin[2];
+        if ((lowest < a.max_height).none())
+        {
+            return lowest - a.max_height;
+        }
+
+        const auto xs = ((x - a.origin[0]) * a.inverse_cell_size)
+                            .clamp(0.F, static_cast<float>(a.width - 1))
+                            .floor();
+        const auto ys = ((y - a.origin[1]) * a.inverse_cell_size)
+                            .clamp(0.F, static_cast<float>(a.height - 1))
+                            .floor();
+
+        const auto size = static_cast<float>(a.tile_size);
+        const auto tx = (xs * (1.F / size)).floor();
+        const auto ty = (ys * (1.F / size)).floor();
+        const auto tile = (ty * static_cast<float>(a.tiles_x) + tx).template to<IndexT>();
+
+        const auto lower = DataT::gather(a.tile_min.data(), tile);
+        const auto upper = DataT::gather(a.tile_max.data(), tile);
+        const auto between = (lowest >= lower) & (lowest < upper);
+        if (between.none())
+        {
+            return lowest - upper;
+        }
+
+        // Lanes that do not need their heights read the first cell instead, which keeps their tiles unread
+        const auto cell = ((ys - ty * size) * size + (xs - tx * size)).template to<IndexT>();
+        const auto index = (tile * static_cast<int>(a.tile_size * a.tile_size) + cell) &
+                           between.template as<IndexT>();
+
+        return lowest - upper.blend(DataT::gather(a.data.data(), index), between);
+    }
 }  // namespace vamp::collision
@@ -22,15 +22,16 @@ namespace vamp::collision
         return sum - rs * rs;
     }
 
-    template <typename DataT>
+    // The sphere may store scalar fields, which are broadcast to the query's data type
+    template <typename DataT, typename PrimitiveDataT>
     inline constexpr auto sphere_sphere_sql2(
-        const Sphere<DataT> &a,
+        const Sphere<PrimitiveDataT> &a,
         const DataT &x,
         const DataT &y,
         const DataT &z,
         const DataT &r) noexcept -> DataT
     {
-        return sphere_sphere_sql2(a.x, a.y, a.z, a.r, x, y, z, r);
+        return sphere_sphere_sql2<DataT>(a.x, a.y, a.z, a.r, x, y, z, r);
     }
 
     template <typename DataT>
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <vamp/collision/buffer.hh>
+#include <vamp/collision/shapes.hh>
+
+namespace vamp::collision
+{
+    // Heightfield over terrain too large to hold in memory (e.g., kilometers of outdoor terrain), stored in a
+    // file of square tiles that is mapped read-only. Tiles are only read from disk when a sphere is checked
+    // against their heights, so only the tiles near the robot become resident.
+    //
+    // Each tile keeps the minimum and maximum of its heights in a small index that is always resident. A
+    // sphere is only tested against the heights of its tile if its lowest point lies between these bounds:
+    // above the maximum it cannot collide, and below the minimum it must. Spheres above the highest tile are
+    // culled without reading the index at all.
+    //
+    // Cell (i, j) covers [i, i + 1) x [j, j + 1) cells from `origin`, and its height is relative to the z of
+    // `origin`. Spheres beyond the edges are checked against the nearest edge cell, as with HeightField.
+    struct TiledHeightField
+    {
+        static constexpr std::array<char, 8> file_magic = {'V', 'A', 'M', 'P', 'T', 'H', 'F', '\0'};
+        static constexpr std::uint32_t file_version = 1;
+
+        // Tile data starts at a multiple of the largest page size in use, so that each tile can be paged in
+        // and out on its own
+        static constexpr std::uint64_t data_alignment = 65536;
+
+        struct Header
+        {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t tile_size;
+            std::uint64_t width;
+            std::uint64_t height;
+            Point origin;
+            float cell_size;
+            std::uint64_t data_offset;
+        };
+
+        TiledHeightField() = default;
+
+        Point origin = {0.F, 0.F, 0.F};
+        float cell_size = 1.F;
+        float inverse_cell_size = 1.F;
+
+        // Number of cells along x and y
+        std::size_t width = 0;
+        std::size_t height = 0;
+
+        // Cells along each side of a tile, which is a power of two
+        std::size_t tile_size = 0;
+        std::size_t tiles_x = 0;
+        std::size_t tiles_y = 0;
+
+        // Highest height of any tile
+        float max_height = -std::numeric_limits<float>::infinity();
+
+        // Bounds of the heights of each tile, row-major over tiles
+        SharedBuffer<float> tile_min;
+        SharedBuffer<float> tile_max;
+
+        // Heights of each tile in turn, each row-major over its cells. Tiles at the far edges are padded with
+        // the heights of the edge cells.
+        SharedBuffer<float> data;
+
+        // File the tiles are mapped from
+        std::string filename;
+
+        // Writes a row-major grid of `width` x `height` heights to a tiled heightfield file.
+        inline static void write(
+            const std::string &filename,
+            const float *heights,
+            std::size_t width,
+            std::size_t height,
+            const Point &origin,
+            float cell_size,
+            std::size_t tile_size = 64)
+        {
+            if (width == 0 or height == 0)
+            {
+                throw std::runtime_error("Tiled heightfield must have at least one cell!");
+            }
+
+            if (tile_size == 0 or (tile_size & (tile_size - 1)) != 0)
+            {
+                throw std::runtime_error("Tile size must be a power of two!");
+            }
+
+            const auto tiles_x = (width + tile_size - 1) / tile_size;
+            const auto tiles_y = (height + tile_size - 1) / tile_size;
+            const auto n_tiles = tiles_x * tiles_y;
+            const auto tile_cells = tile_size * tile_size;
+
+            // Cells are gathered with 32-bit indices
+            if (n_tiles * tile_cells > static_cast<std::size_t>(std::numeric_limits<int32_t>::max()))
+            {
+                throw std::runtime_error("Tiled heightfield has too many cells!");
+            }
+
+            std::ofstream file(filename, std::ios::binary);
+            if (not file)
+            {
+                throw std::runtime_error("Failed to create tiled heightfield " + filename + "!");
+            }
+
+            const auto index_size = 2 * n_tiles * sizeof(float);
+            const auto data_offset =
+                (sizeof(Header) + index_size + data_alignment - 1) / data_alignment * data_alignment;
+
+            const Header header = {
+                file_magic,
+                file_version,
+                static_cast<std::uint32_t>(tile_size),
+                width,
+                height,
+                origin,
+                cell_size,
+                data_offset};
+
+            std::vector<float> tiles_min(n_tiles, std::numeric_limits<float>::infinity());
+            std::vector<float> tiles_max(n_tiles, -std::numeric_limits<float>::infinity());
+            for (auto y = 0U; y < height; ++y)
+            {
+                for (auto x = 0U; x < width; ++x)
+                {
+                    const auto tile = (y / tile_size) * tiles_x + x / tile_size;
+                    tiles_min[tile] = std::min(tiles_min[tile], heights[y * width + x]);
+                    tiles_max[tile] = std::max(tiles_max[tile], heights[y * width + x]);
+                }
+            }
+
+            file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+            file.write(reinterpret_cast<const char *>(tiles_min.data()), n_tiles * sizeof(float));
+            file.write(reinterpret_cast<const char *>(tiles_max.data()), n_tiles * sizeof(float));
+
+            const std::vector<char> padding(data_offset - sizeof(Header) - index_size, 0);
+            file.write(padding.data(), padding.size());
+
+            std::vector<float> tile(tile_cells);
+            for (auto ty = 0U; ty < tiles_y; ++ty)
+            {
+                for (auto tx = 0U; tx < tiles_x; ++tx)
+                {
+                    for (auto j = 0U; j < tile_size; ++j)
+                    {
+                        const auto y = std::min<std::size_t>(ty * tile_size + j, height - 1);
+                        for (auto i = 0U; i < tile_size; ++i)
+                        {
+                            const auto x = std::min<std::size_t>(tx * tile_size + i, width - 1);
+                            tile[j * tile_size + i] = heights[y * width + x];
+                        }
+                    }
+
+                    file.write(reinterpret_cast<const char *>(tile.data()), tile_cells * sizeof(float));
+                }
+            }
+
+            if (not file)
+            {
+                throw std::runtime_error("Failed to write tiled heightfield " + filename + "!");
+            }
+        }
+
+        // Maps a tiled heightfield file read-only. Only the index of tile bounds is read up front.
+        inline static auto open(const std::string &filename) -> TiledHeightField
+        {
+            const int fd = ::open(filename.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                throw std::runtime_error(
+                    "Failed to open tiled heightfield " + filename + ": " + std::strerror(errno));
+            }
+
+            struct stat info;
+            if (fstat(fd, &info) != 0)
+            {
+                const auto error = errno;
+                close(fd);
+                throw std::runtime_error(
+                    "Failed to stat tiled heightfield " + filename + ": " + std::strerror(error));
+            }
+
+            const auto size = static_cast<std::size_t>(info.st_size);
+            if (size < sizeof(Header))
+            {
+                close(fd);
+                throw std::runtime_error("File " + filename + " is not a tiled heightfield!");
+            }
+
+            void *memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+            if (memory == MAP_FAILED)
+            {
+                throw std::runtime_error(
+                    "Failed to map tiled heightfield " + filename + ": " + std::strerror(errno));
+            }
+
+            std::shared_ptr<const void> mapping(
+                memory, [size](const void *p) { munmap(const_cast<void *>(p), size); });
+
+            Header header;
+            std::memcpy(&header, memory, sizeof(Header));
+
+            // The same limits as write(), which also keep the sizes below from overflowing
+            constexpr auto max_cells = static_cast<std::uint64_t>(std::numeric_limits<int32_t>::max());
+            const auto valid_tiles = header.width != 0 and header.height != 0 and header.tile_size != 0 and
+                                     (header.tile_size & (header.tile_size - 1)) == 0 and
+                                     header.width <= max_cells and header.height <= max_cells and
+                                     header.tile_size <= max_cells;
+            const auto tiles_x = valid_tiles ? (header.width + header.tile_size - 1) / header.tile_size : 0;
+            const auto tiles_y = valid_tiles ? (header.height + header.tile_size - 1) / header.tile_size : 0;
+            const auto tile_cells = static_cast<std::uint64_t>(header.tile_size) * header.tile_size;
+            const auto valid_cells = valid_tiles and tiles_x * tiles_y <= max_cells / tile_cells;
+
+            // The tile bounds sit between the header and the heights
+            const auto bounds_end = sizeof(Header) + 2 * tiles_x * tiles_y * sizeof(float);
+            if (header.magic != file_magic or header.version != file_version or not valid_cells or
+                header.data_offset < bounds_end or header.data_offset % sizeof(float) != 0)
+            {
+                throw std::runtime_error("File " + filename + " is not a tiled heightfield!");
+            }
+
+            TiledHeightField h;
+            h.origin = header.origin;
+            h.cell_size = header.cell_size;
+            h.inverse_cell_size = 1.F / header.cell_size;
+            h.width = header.width;
+            h.height = header.height;
+            h.tile_size = header.tile_size;
+            h.tiles_x = tiles_x;
+            h.tiles_y = tiles_y;
+            h.filename = filename;
+
+            const auto n_tiles = h.tiles_x * h.tiles_y;
+            const auto n_cells = n_tiles * h.tile_size * h.tile_size;
+            if (header.data_offset > size or size - header.data_offset != n_cells * sizeof(float))
+            {
+                throw std::runtime_error("Tiled heightfield " + filename + " is truncated!");
+            }
+
+            const auto *bytes = static_cast<const char *>(memory);
+            const auto *bounds = reinterpret_cast<const float *>(bytes + sizeof(Header));
+            h.tile_min = SharedBuffer<float>(bounds, n_tiles, mapping);
+            h.tile_max = SharedBuffer<float>(bounds + n_tiles, n_tiles, mapping);
+            h.data = SharedBuffer<float>(
+                reinterpret_cast<const float *>(bytes + header.data_offset), n_cells, mapping);
+            h.max_height = *std::max_element(h.tile_max.begin(), h.tile_max.end());
+
+            // Spheres are scattered across the tiles, so reading ahead would only page in distant tiles
+            madvise(const_cast<char *>(bytes + header.data_offset), n_cells * sizeof(float), MADV_RANDOM);
+
+            return h;
+        }
+
+        // Advises the kernel to page in the tiles within `radius` of (x, y), and that all others may be
+        // dropped from memory, e.g., as a mobile base moves across the terrain. Dropped tiles are read from
+        // the file again if they are checked later.
+        inline void advise(float x, float y, float radius) const noexcept
+        {
+            const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            const auto tile_bytes = tile_size * tile_size * sizeof(float);
+            const auto base = reinterpret_cast<std::uintptr_t>(data.data());
+
+            const auto near = [&](std::size_t tile)
+            {
+                const auto extent = static_cast<float>(tile_size) * cell_size;
+                const auto x0 = origin[0] + static_cast<float>(tile % tiles_x) * extent;
+                const auto y0 = origin[1] + static_cast<float>(tile / tiles_x) * extent;
+                const auto dx = x - std::clamp(x, x0, x0 + extent);
+                const auto dy = y - std::clamp(y, y0, y0 + extent);
+                return dx * dx + dy * dy <= radius * radius;
+            };
+
+            // Runs of tiles that are contiguous in the file are advised together. Pages that are only partly
+            // within a run of near tiles are kept.
+            const auto n_tiles = tiles_x * tiles_y;
+            for (std::size_t begin = 0, end = 0; begin < n_tiles; begin = end)
+            {
+                const auto keep = near(begin);
+                for (end = begin + 1; end < n_tiles and near(end) == keep; ++end)
+                {
+                }
+
+                auto first = base + begin * tile_bytes;
+                auto last = base + end * tile_bytes;
+                if (keep)
+                {
+                    first = first / page * page;
+                    last = (last + page - 1) / page * page;
+                }
+                else
+                {
+                    first = (first + page - 1) / page * page;
+                    last = last / page * page;
+                }
+
+                if (first < last)
+                {
+                    const auto advice = (keep) ? MADV_WILLNEED : MADV_DONTNEED;
+                    madvise(reinterpret_cast<void *>(first), last - first, advice);
+                }
+            }
+        }
+    };
+}  // namespace vamp::collision
@@ -8,6 +8,9 @@
 #include <vamp/collision/sphere_heightfield.hh>
 #include <vamp/collision/math.hh>
 
+// Sphere arguments may be scalars (e.g., the constant radius of the sphere robot) or vectors of the
+// environment's data type, as the robots' generated code passes them. Each check converts them once on entry,
+// which broadcasts scalars and is free for vectors, so the kernels only handle one type.
 namespace vamp
 {
     template <
@@ -39,23 +42,19 @@ namespace vamp
         auto bz = static_cast<VectorDataT>(bz_);
         auto br = static_cast<VectorDataT>(br_);
 
-        // TODO: Figure out a way to avoid needing to upcast floats to vectors
         return not collision::sphere_sphere_sql2(ax, ay, az, ar, bx, by, bz, br).test_zero();
     }
 
-    template <typename DataT, typename ArgT1, typename ArgT2, typename ArgT3, typename ArgT4>
-    inline constexpr auto sphere_environment_in_collision(
-        const collision::Environment<DataT> &e,  //
-        ArgT1 sx_,
-        ArgT2 sy_,
-        ArgT3 sz_,
-        ArgT4 sr_) noexcept -> bool
+    // Primitives are sorted by their distance from the origin, so each loop stops at the first primitive
+    // beyond the reach of the sphere
+    template <typename PrimitivesT, typename DataT>
+    inline constexpr auto sphere_primitives_in_collision(
+        const PrimitivesT &e,
+        const DataT &sx,
+        const DataT &sy,
+        const DataT &sz,
+        const DataT &sr) noexcept -> bool
     {
-        // TODO: Figure out a way to avoid needing to upcast floats to vectors
-        auto sx = static_cast<DataT>(sx_);
-        auto sy = static_cast<DataT>(sy_);
-        auto sz = static_cast<DataT>(sz_);
-        auto sr = static_cast<DataT>(sr_);
         const auto max_extent = collision::sqrt(collision::dot_3(sx, sy, sz, sx, sy, sz)) + sr;
 
         for (const auto &es : e.spheres)
@@ -129,6 +128,17 @@ namespace vamp
             }
         }
 
+        return false;
+    }
+
+    template <typename DataT>
+    inline constexpr auto sphere_fields_in_collision(
+        const collision::Environment<DataT> &e,
+        const DataT &sx,
+        const DataT &sy,
+        const DataT &sz,
+        const DataT &sr) noexcept -> bool
+    {
         for (const auto &eh : e.heightfields)
         {
             if (not collision::sphere_heightfield(eh, sx, sy, sz, sr).test_zero())
@@ -137,7 +147,21 @@ namespace vamp
             }
         }
 
+        for (const auto &et : e.tiled_heightfields)
+        {
+            if (not collision::sphere_tiled_heightfield(et, sx, sy, sz, sr).test_zero())
+            {
+                return true;
+            }
+        }
+
         const std::array<DataT, 3> positions = {sx, sy, sz};
+        if (e.pointcloud_bvh.indexes(e.pointclouds))
+        {
+            return e.pointcloud_bvh.any(
+                positions, sr, [&](std::size_t i) { return e.pointclouds[i].collides_simd(positions, sr); });
+        }
+
         for (const auto &pc : e.pointclouds)
         {
             if (pc.collides_simd(positions, sr))
@@ -149,6 +173,45 @@ namespace vamp
         return false;
     }
 
+    template <typename DataT, typename ArgT1, typename ArgT2, typename ArgT3, typename ArgT4>
+    inline constexpr auto sphere_environment_in_collision(
+        const collision::Environment<DataT> &e,  //
+        ArgT1 sx_,
+        ArgT2 sy_,
+        ArgT3 sz_,
+        ArgT4 sr_) noexcept -> bool
+    {
+        auto sx = static_cast<DataT>(sx_);
+        auto sy = static_cast<DataT>(sy_);
+        auto sz = static_cast<DataT>(sz_);
+        auto sr = static_cast<DataT>(sr_);
+
+        return sphere_primitives_in_collision(e, sx, sy, sz, sr) or
+               sphere_fields_in_collision(e, sx, sy, sz, sr);
+    }
+
+    // Checks a sphere of the given link only against the primitives within that link's reach, if the
+    // environment has been compiled for the robot
+    template <typename DataT, typename ArgT1, typename ArgT2, typename ArgT3, typename ArgT4>
+    inline constexpr auto sphere_environment_in_collision(
+        const collision::Environment<DataT> &e,
+        std::size_t link,
+        ArgT1 sx_,
+        ArgT2 sy_,
+        ArgT3 sz_,
+        ArgT4 sr_) noexcept -> bool
+    {
+        auto sx = static_cast<DataT>(sx_);
+        auto sy = static_cast<DataT>(sy_);
+        auto sz = static_cast<DataT>(sz_);
+        auto sr = static_cast<DataT>(sr_);
+
+        const auto in_collision = (e.links) ?
+                                      sphere_primitives_in_collision(e.links->links[link], sx, sy, sz, sr) :
+                                      sphere_primitives_in_collision(e, sx, sy, sz, sr);
+        return in_collision or sphere_fields_in_collision(e, sx, sy, sz, sr);
+    }
+
     template <typename DataT, typename ArgT1, typename ArgT2, typename ArgT3, typename ArgT4>
     inline auto sphere_environment_get_collisions(
         const collision::Environment<DataT> &e,  //
@@ -159,7 +222,6 @@ namespace vamp
     {
         std::vector<std::string> objects;
 
-        // TODO: Figure out a way to avoid needing to upcast floats to vectors
         auto sx = static_cast<DataT>(sx_);
         auto sy = static_cast<DataT>(sy_);
         auto sz = static_cast<DataT>(sz_);
@@ -254,11 +316,7 @@ namespace vamp
     {
         for (const auto &s : e.attachments->posed_spheres)
         {
-            // HACK: The radius needs to be a float, and unfortunately the spheres assume homogeneous
-            // DataT for storage
-            // TODO: Fix the sphere representation to allow to store float radii even with vector
-            // centers
-            if (sphere_environment_in_collision(e, s.x, s.y, s.z, s.r[{0, 0}]))
+            if (sphere_environment_in_collision(e, s.x, s.y, s.z, s.r))
             {
                 return true;
             }
@@ -275,7 +333,6 @@ namespace vamp
         ArgT3 sz_,
         ArgT4 sr_) noexcept -> bool
     {
-        // TODO: Figure out a way to avoid needing to upcast floats to vectors
         auto sx = static_cast<DataT>(sx_);
         auto sy = static_cast<DataT>(sy_);
         auto sz = static_cast<DataT>(sz_);
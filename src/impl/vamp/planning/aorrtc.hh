@@ -274,13 +274,17 @@ namespace vamp::planning
                     const float increment_length = other_nearest_distance / static_cast<float>(n_extensions);
                     const auto increment = other_nearest_vector * (1.0F / static_cast<float>(n_extensions));
 
+                    // Nodes are only added for the valid prefix of the increments that fit in the tree
+                    const auto n_valid = validate_connect<Robot, rake, resolution>(
+                        new_configuration,
+                        increment,
+                        increment_length,
+                        std::min(n_extensions, rrtc_settings.max_samples - free_index),
+                        environment);
+
                     std::size_t i_extension = 0;
                     auto prior = new_configuration;
-                    for (; i_extension < n_extensions and
-                           validate_vector<Robot, rake, resolution>(
-                               prior, increment, increment_length, environment) and
-                           free_index < rrtc_settings.max_samples;
-                         ++i_extension)
+                    for (; i_extension < n_valid; ++i_extension)
                     {
                         const auto next = prior + increment;
                         add_to_tree(
@@ -367,9 +371,10 @@ namespace vamp::planning
             const Configuration &goal,
             const collision::Environment<FloatVector<rake>> &environment,
             const AORRTCSettings &settings,
-            typename RNG::Ptr rng) noexcept -> PlanningResult<Robot>
+            typename RNG::Ptr rng,
+            const SolutionCallback<Robot> &on_solution = {}) noexcept -> PlanningResult<Robot>
         {
-            return solve(start, std::vector<Configuration>{goal}, environment, settings, rng);
+            return solve(start, std::vector<Configuration>{goal}, environment, settings, rng, on_solution);
         }
 
         inline static auto solve(
@@ -377,7 +382,8 @@ namespace vamp::planning
             const std::vector<Configuration> &goals,
             const collision::Environment<FloatVector<rake>> &environment,
             const AORRTCSettings &settings_in,
-            typename RNG::Ptr rng) noexcept -> PlanningResult<Robot>
+            typename RNG::Ptr rng,
+            const SolutionCallback<Robot> &on_solution = {}) noexcept -> PlanningResult<Robot>
         {
             auto start_time = std::chrono::steady_clock::now();
 
@@ -408,8 +414,12 @@ namespace vamp::planning
                 result = simplify<Robot, rake, resolution>(result.path, environment, settings.simplify, rng);
             }
 
-            // Exit early if trivial, unsolved, or not optimizing
-            if (not settings.optimize or result.path.empty() or result.path.size() == 2)
+            // Report the initial solution, which may also be asked to stop the search
+            const auto stop = [&on_solution](const Path<Robot> &path)
+            { return on_solution and on_solution(path, path.cost()); };
+
+            // Exit early if trivial, unsolved, not optimizing, or stopped
+            if (result.path.empty() or stop(result.path) or not settings.optimize or result.path.size() == 2)
             {
                 return result;
             }
@@ -425,10 +435,32 @@ namespace vamp::planning
                 best_possible_cost = std::min(best_possible_cost, start.distance(goal));
             }
 
-            ProlateHyperspheroid<Robot> phs(start, goals[0]);
-            phs.set_transverse_diameter(best_path_cost);
+            // Goals at least as far from the start as the best solution cannot improve on it, so are dropped
+            // from later searches
+            std::vector<Configuration> active_goals;
+            const auto prune_goals = [&]()
+            {
+                active_goals.clear();
+                for (const auto &goal : goals)
+                {
+                    if (start.distance(goal) < best_path_cost)
+                    {
+                        active_goals.emplace_back(goal);
+                    }
+                }
+            };
+
+            prune_goals();
 
-            auto phs_rng = std::make_shared<ProlateHyperspheroidRNG<Robot>>(phs, rng);
+            // Informed sampling from the union of the PHS of each goal
+            auto phs_rng = std::make_shared<MultiProlateHyperspheroidRNG<Robot>>(start, goals, rng);
+            phs_rng->set_transverse_diameter(best_path_cost);
+
+            typename RNG::Ptr sampler = rng;
+            if (settings.use_phs)
+            {
+                sampler = phs_rng;
+            }
 
             AOX_RRTC instance(max_samples);
 
@@ -443,27 +475,13 @@ namespace vamp::planning
                 // By default, use AORRTC
                 if (not settings.anytime)
                 {
-                    // If there is a single goal, sample with PHS
-                    if (settings.use_phs and goals.size() == 1)
-                    {
-                        result = instance.solve(start, goals, environment, settings, best_path_cost, phs_rng);
-                    }
-                    else
-                    {
-                        result = instance.solve(start, goals, environment, settings, best_path_cost, rng);
-                    }
+                    result =
+                        instance.solve(start, active_goals, environment, settings, best_path_cost, sampler);
                 }
                 // If anytime, use Anytime RRTC
                 else
                 {
-                    if (settings.use_phs and goals.size() == 1)
-                    {
-                        result = RRTC::solve(start, goals, environment, rrtc_settings, phs_rng);
-                    }
-                    else
-                    {
-                        result = RRTC::solve(start, goals, environment, rrtc_settings, rng);
-                    }
+                    result = RRTC::solve(start, active_goals, environment, rrtc_settings, sampler);
                 }
 
                 iters += result.iterations;
@@ -485,7 +503,13 @@ namespace vamp::planning
                         final_result.path = result.path;
                         best_path_cost = result.path.cost();
 
-                        phs_rng->phs.set_transverse_diameter(best_path_cost);
+                        phs_rng->set_transverse_diameter(best_path_cost);
+                        prune_goals();
+
+                        if (stop(final_result.path))
+                        {
+                            break;
+                        }
                     }
                 }
             }
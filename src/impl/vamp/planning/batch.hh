@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/planning/plan.hh>
+#include <vamp/planning/simplify.hh>
+#include <vamp/planning/simplify_settings.hh>
+#include <vamp/random/stream.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/thread_pool.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    template <typename Robot>
+    struct BatchQuery
+    {
+        typename Robot::Configuration start;
+        std::vector<typename Robot::Configuration> goals;
+    };
+
+    template <typename Robot>
+    struct BatchResult
+    {
+        PlanningResult<Robot> plan;
+
+        // Only present if simplification was requested and the query was solved
+        std::optional<PlanningResult<Robot>> simplified;
+    };
+
+    // Solves many queries in the same environment, e.g., every (pick, place) pair of a task planner's
+    // candidates, and returns their results in the order of the queries. Queries run across threads with
+    // work stealing, as their solve times vary widely, and solved paths are simplified on the thread that
+    // solved them. Every query shares the one environment and draws from its own random stream, keyed by
+    // `seed` and the index of the query, so results do not depend on the number of threads. The robot
+    // instance bound to the calling thread is bound to every worker.
+    template <typename Robot, std::size_t rake, std::size_t resolution, typename Planner, typename Settings>
+    inline auto solve_batch(
+        const std::vector<BatchQuery<Robot>> &queries,
+        const collision::Environment<FloatVector<rake>> &environment,
+        const Settings &settings,
+        const std::optional<SimplifySettings> &simplify_settings = std::nullopt,
+        std::uint64_t seed = 0,
+        std::size_t n_threads = std::thread::hardware_concurrency()) -> std::vector<BatchResult<Robot>>
+    {
+        const auto &instance = robots::Instance<Robot>::current();
+
+        std::vector<BatchResult<Robot>> results(queries.size());
+        vamp::utils::parallel_for_stealing(
+            n_threads,
+            queries.size(),
+            [&](std::size_t i)
+            {
+                const typename robots::Instance<Robot>::Scope scope(instance);
+                // Held as the base pointer, as some planners take it by reference
+                typename vamp::rng::RNG<Robot>::Ptr rng =
+                    std::make_shared<vamp::rng::Stream<Robot>>(seed + 1, i + 1);
+
+                const auto &query = queries[i];
+                auto &result = results[i];
+                result.plan = Planner::solve(query.start, query.goals, environment, settings, rng);
+
+                if (simplify_settings and not result.plan.path.empty())
+                {
+                    result.simplified = simplify<Robot, rake, resolution>(
+                        result.plan.path, environment, *simplify_settings, rng);
+                }
+            });
+
+        return results;
+    }
+}  // namespace vamp::planning
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+
+#include <Eigen/Geometry>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/planning/cartesian_settings.hh>
+#include <vamp/planning/ik.hh>
+#include <vamp/planning/plan.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/utils.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    template <typename Robot>
+    struct CartesianResult
+    {
+        // Starts at the start configuration, and ends at the last waypoint reached
+        Path<Robot> path;
+
+        // Fraction of the line that the path follows
+        float fraction{0.};
+
+        std::size_t nanoseconds{0};
+    };
+
+    // Moves the end-effector along the straight line from its pose at `start` to `goal`, e.g., for insertion
+    // and approach moves, interpolating the position linearly and the orientation spherically. Waypoints are
+    // solved by IK rake at a time, one per lane, each seeded with the last waypoint reached. Stops at the
+    // first waypoint that IK cannot reach, that jumps too far in joint space, or whose motion from the last
+    // waypoint is invalid, and returns the path up to there with the fraction of the line it covers.
+    template <typename Robot, std::size_t rake, std::size_t resolution>
+    inline auto cartesian_path(
+        const typename Robot::Configuration &start,
+        const Eigen::Isometry3f &goal,
+        const collision::Environment<FloatVector<rake>> &environment,
+        const CartesianSettings &settings) noexcept -> CartesianResult<Robot>
+    {
+        using Configuration = typename Robot::Configuration;
+
+        auto start_time = std::chrono::steady_clock::now();
+
+        const auto to_array = [](const Configuration &c)
+        {
+            typename Robot::ConfigurationArray array;
+            const auto padded = c.to_array();
+            std::copy_n(padded.cbegin(), Robot::dimension, array.begin());
+            return array;
+        };
+
+        const auto from = Robot::eefk(to_array(start));
+        const Eigen::Vector3f from_position = from.translation();
+        const Eigen::Vector3f to_position = goal.translation();
+        const Eigen::Quaternionf from_rotation(from.rotation());
+        const Eigen::Quaternionf to_rotation(goal.rotation());
+
+        const auto n = static_cast<std::size_t>(std::max(
+            std::ceil(std::max(
+                (to_position - from_position).norm() / settings.max_translation_step,
+                from_rotation.angularDistance(to_rotation) / settings.max_rotation_step)),
+            1.F));
+
+        CartesianResult<Robot> result;
+        result.path.emplace_back(start);
+
+        for (std::size_t base = 0; base < n; base += rake)
+        {
+            // Lanes past the end of the line repeat its end
+            std::array<std::array<float, rake>, 12> lanes;
+            for (auto i = 0U; i < rake; ++i)
+            {
+                const auto t = static_cast<float>(std::min(base + i + 1, n)) / static_cast<float>(n);
+                const Eigen::Vector3f position = from_position + t * (to_position - from_position);
+                const Eigen::Matrix3f rotation = from_rotation.slerp(t, to_rotation).toRotationMatrix();
+
+                for (auto k = 0U; k < 3; ++k)
+                {
+                    lanes[k][i] = position[k];
+                }
+
+                for (auto k = 0U; k < 9; ++k)
+                {
+                    lanes[3 + k][i] = rotation(k % 3, k / 3);
+                }
+            }
+
+            Pose<rake> target;
+            for (auto k = 0U; k < 12; ++k)
+            {
+                target[k] = FloatVector<rake>(lanes[k]);
+            }
+
+            const auto last = to_array(result.path.back());
+            typename Robot::template ConfigurationBlock<rake> block;
+            for (auto j = 0U; j < Robot::dimension; ++j)
+            {
+                block[j] = FloatVector<rake>::fill(last[j]);
+            }
+
+            const auto converged =
+                solve_ik<Robot, rake>(block, target, settings.ik).template as<IntVector<rake>>().to_array();
+            const auto solutions = block.to_array();
+
+            for (auto i = 0U; i < rake and base + i < n; ++i)
+            {
+                typename Robot::ConfigurationArray array;
+                for (auto j = 0U; j < Robot::dimension; ++j)
+                {
+                    array[j] = solutions[j * rake + i];
+                }
+
+                const Configuration waypoint(array);
+                const auto &previous = result.path.back();
+                if (converged[i] == 0 or waypoint.distance(previous) > settings.max_joint_jump or
+                    not validate_motion<Robot, rake, resolution>(previous, waypoint, environment))
+                {
+                    result.fraction = static_cast<float>(base + i) / static_cast<float>(n);
+                    result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+                    return result;
+                }
+
+                result.path.emplace_back(waypoint);
+            }
+        }
+
+        result.fraction = 1.F;
+        result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+        return result;
+    }
+}  // namespace vamp::planning
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+#include <vamp/planning/ik_settings.hh>
+
+namespace vamp::planning
+{
+    struct CartesianSettings
+    {
+        IKSettings ik;
+
+        // Largest distance, in meters, and rotation, in radians, of the end-effector between waypoints
+        float max_translation_step = 0.01;
+        float max_rotation_step = 0.05;
+
+        // Largest joint-space distance between consecutive waypoints. Larger jumps mean that the solution
+        // switched to another IK branch, which would not follow the line between them.
+        float max_joint_jump = 0.5;
+    };
+}  // namespace vamp::planning
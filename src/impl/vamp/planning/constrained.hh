@@ -0,0 +1,392 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/planning/constrained_settings.hh>
+#include <vamp/planning/ik.hh>
+#include <vamp/planning/nn.hh>
+#include <vamp/planning/plan.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/random/rng.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/utils.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    // Displacement of the constrained axis of each lane of `pose` toward the direction of `constraint`, in
+    // the rotation rows of a PoseError, with the translation rows zero so that they are left free. The
+    // direction must be of unit length.
+    template <std::size_t rake>
+    inline auto constraint_error(const Pose<rake> &pose, const OrientationConstraint &constraint) noexcept
+        -> PoseError<rake>
+    {
+        const auto *axis = &pose[3 + 3 * constraint.axis];
+
+        PoseError<rake> error;
+        for (auto k = 0U; k < 3; ++k)
+        {
+            error[k] = FloatVector<rake>::fill(0.F);
+            error[3 + k] = FloatVector<rake>::fill(constraint.direction[k]) - axis[k];
+        }
+
+        return error;
+    }
+
+    // Projects each lane of `block` onto `constraint` by damped least squares on the constrained axis,
+    // within the joint limits of the robot instance bound to this thread. Lanes stop moving once they
+    // satisfy the constraint. Returns the mask of lanes that satisfy it.
+    template <typename Robot, std::size_t rake>
+    inline auto project(
+        typename Robot::template ConfigurationBlock<rake> &block,
+        OrientationConstraint constraint,
+        const IKSettings &settings) noexcept -> FloatVector<rake>
+    {
+        const auto &instance = robots::Instance<Robot>::current();
+        const auto lows = instance.lows();
+        const auto highs = instance.highs();
+
+        const auto &d = constraint.direction;
+        const auto length = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        for (auto &e : constraint.direction)
+        {
+            e /= length;
+        }
+
+        // The distance between unit vectors at an angle of the tolerance
+        const auto chord = 2.F * std::sin(0.5F * constraint.tolerance);
+        const auto tolerance = chord * chord;
+
+        for (auto iteration = 0U;; ++iteration)
+        {
+            const auto error = constraint_error<rake>(Robot::template eefk<rake>(block), constraint);
+            const auto satisfied =
+                (error[3] * error[3] + error[4] * error[4] + error[5] * error[5]) <= tolerance;
+            if (satisfied.all() or iteration == settings.max_iterations)
+            {
+                return satisfied;
+            }
+
+            // The error moves against the axis, so its forward differences are negated
+            Jacobian<Robot, rake> J;
+            auto perturbed = block;
+            for (auto j = 0U; j < Robot::dimension; ++j)
+            {
+                perturbed[j] = block[j] + settings.jacobian_step;
+                const auto moved = constraint_error<rake>(Robot::template eefk<rake>(perturbed), constraint);
+                for (auto k = 0U; k < 6; ++k)
+                {
+                    J[k][j] = (error[k] - moved[k]) * (1.F / settings.jacobian_step);
+                }
+
+                perturbed[j] = block[j];
+            }
+
+            const auto step = dls_step<Robot, rake>(J, error, settings.damping);
+            take_step<Robot, rake>(block, step, lows, highs, satisfied, settings);
+        }
+    }
+
+    // RRTConnect on the states that satisfy an orientation constraint. Samples are drawn rake at a time and
+    // projected onto the constraint together. Extensions walk toward their target in steps of at most
+    // `step`: the next rake states along the line to the target are projected in one batch, and accepted in
+    // order while each stays close to the last and its motion from it is valid. The start and goals must
+    // satisfy the constraint; states in between satisfy it within its tolerance, with straight motions of at
+    // most `step` between them.
+    template <typename Robot, std::size_t rake, std::size_t resolution, typename NNT = NN<Robot::dimension>>
+    struct ConstrainedRRTC
+    {
+        using Configuration = typename Robot::Configuration;
+        static constexpr auto dimension = Robot::dimension;
+        using RNG = typename vamp::rng::RNG<Robot>;
+        using Block = typename Robot::template ConfigurationBlock<rake>;
+
+        inline static auto solve(
+            const Configuration &start,
+            const Configuration &goal,
+            const collision::Environment<FloatVector<rake>> &environment,
+            const ConstrainedRRTCSettings &settings,
+            typename RNG::Ptr rng) noexcept -> PlanningResult<Robot>
+        {
+            return solve(start, std::vector<Configuration>{goal}, environment, settings, rng);
+        }
+
+        inline static auto solve(
+            const Configuration &start,
+            const std::vector<Configuration> &goals,
+            const collision::Environment<FloatVector<rake>> &environment,
+            const ConstrainedRRTCSettings &settings,
+            typename RNG::Ptr rng) noexcept -> PlanningResult<Robot>
+        {
+            PlanningResult<Robot> result;
+
+            NNT start_tree;
+            NNT goal_tree;
+
+            constexpr const std::size_t start_index = 0;
+            const auto max_samples = settings.rrtc.max_samples;
+
+            auto buffer = std::unique_ptr<float, decltype(&free)>(
+                vamp::utils::vector_alloc<float, FloatVectorAlignment, FloatVectorWidth>(
+                    max_samples * Configuration::num_scalars_rounded),
+                &free);
+
+            const auto buffer_index = [&buffer](std::size_t index) -> float *
+            { return buffer.get() + index * Configuration::num_scalars_rounded; };
+
+            std::vector<std::size_t> parents(max_samples);
+
+            auto start_time = std::chrono::steady_clock::now();
+
+            std::size_t iter = 0;
+            std::size_t free_index = start_index;
+
+            const auto add = [&](NNT *tree, const Configuration &configuration, std::size_t parent)
+            {
+                float *index = buffer_index(free_index);
+                configuration.to_array(index);
+                tree->insert(NNNode<dimension>{free_index, {index}});
+                parents[free_index] = parent;
+                return free_index++;
+            };
+
+            // Roots are their own parents
+            add(&start_tree, start, start_index);
+            for (const auto &goal : goals)
+            {
+                add(&goal_tree, goal, free_index);
+            }
+
+            const auto to_array = [](const Configuration &c)
+            {
+                typename Robot::ConfigurationArray array;
+                const auto padded = c.to_array();
+                std::copy_n(padded.cbegin(), dimension, array.begin());
+                return array;
+            };
+
+            const auto lane = [](const auto &states, std::size_t i)
+            {
+                typename Robot::ConfigurationArray array;
+                for (auto j = 0U; j < dimension; ++j)
+                {
+                    array[j] = states[j * rake + i];
+                }
+
+                return Configuration(array);
+            };
+
+            using Lanes = std::array<std::array<float, rake>, dimension>;
+
+            // Projects the states in `lanes`, one per lane, onto the constraint. Returns the mask of lanes
+            // that satisfy it, and the projected states.
+            const auto project_lanes = [&settings](const Lanes &lanes)
+            {
+                Block block;
+                for (auto j = 0U; j < dimension; ++j)
+                {
+                    block[j] = FloatVector<rake>(lanes[j]);
+                }
+
+                const auto satisfied = project<Robot, rake>(block, settings.constraint, settings.projection);
+                return std::make_pair(satisfied.template as<IntVector<rake>>().to_array(), block.to_array());
+            };
+
+            // Grows `tree` from the node `from` toward `target` along the constraint. Returns the last node
+            // added, or `from` if none was, and whether it reached the target.
+            const auto extend = [&](NNT *tree, std::size_t from, const Configuration &target)
+                -> std::pair<std::size_t, bool>
+            {
+                const auto goal = to_array(target);
+
+                auto last = from;
+                auto current = Configuration(buffer_index(from));
+                while (free_index < max_samples)
+                {
+                    const auto distance = current.distance(target);
+                    if (distance <= settings.step)
+                    {
+                        if (not validate_vector<Robot, rake, resolution>(
+                                current, target - current, distance, environment))
+                        {
+                            return {last, false};
+                        }
+
+                        return {add(tree, target, last), true};
+                    }
+
+                    // Lanes hold the states one step apart along the line toward the target, short of it
+                    const auto steps = static_cast<std::size_t>(std::ceil(distance / settings.step));
+                    const auto n = std::min<std::size_t>(rake, steps - 1);
+                    const auto origin = to_array(current);
+
+                    Lanes lanes;
+                    for (auto i = 0U; i < rake; ++i)
+                    {
+                        const auto t = static_cast<float>(std::min<std::size_t>(i + 1, n)) * settings.step /
+                                       distance;
+                        for (auto j = 0U; j < dimension; ++j)
+                        {
+                            lanes[j][i] = origin[j] + t * (goal[j] - origin[j]);
+                        }
+                    }
+
+                    const auto [satisfied, states] = project_lanes(lanes);
+
+                    for (auto i = 0U; i < n; ++i)
+                    {
+                        // Projections that jump away, or that make no progress, have left the piece of the
+                        // constraint between the states
+                        const auto next = lane(states, i);
+                        const auto length = next.distance(current);
+                        if (satisfied[i] == 0 or length > 2.F * settings.step or
+                            next.distance(target) >= current.distance(target) or
+                            not validate_vector<Robot, rake, resolution>(
+                                current, next - current, length, environment))
+                        {
+                            return {last, false};
+                        }
+
+                        last = add(tree, next, last);
+                        current = next;
+
+                        if (free_index == max_samples)
+                        {
+                            return {last, false};
+                        }
+                    }
+                }
+
+                return {last, false};
+            };
+
+            // Projected samples not yet used
+            std::vector<Configuration> samples;
+            const auto sample = [&]() -> std::optional<Configuration>
+            {
+                if (samples.empty())
+                {
+                    Lanes lanes;
+                    for (auto i = 0U; i < rake; ++i)
+                    {
+                        const auto state = to_array(rng->next());
+                        for (auto j = 0U; j < dimension; ++j)
+                        {
+                            lanes[j][i] = state[j];
+                        }
+                    }
+
+                    const auto [satisfied, states] = project_lanes(lanes);
+                    for (auto i = 0U; i < rake; ++i)
+                    {
+                        if (satisfied[i] != 0)
+                        {
+                            samples.emplace_back(lane(states, i));
+                        }
+                    }
+
+                    if (samples.empty())
+                    {
+                        return std::nullopt;
+                    }
+                }
+
+                auto next = samples.back();
+                samples.pop_back();
+                return next;
+            };
+
+            // trees
+            bool tree_a_is_start = not settings.rrtc.start_tree_first;
+            auto *tree_a = (settings.rrtc.start_tree_first) ? &goal_tree : &start_tree;
+            auto *tree_b = (settings.rrtc.start_tree_first) ? &start_tree : &goal_tree;
+
+            while (iter++ < settings.rrtc.max_iterations and free_index < max_samples)
+            {
+                float asize = tree_a->size();
+                float bsize = tree_b->size();
+                float ratio = std::abs(asize - bsize) / asize;
+
+                if ((not settings.rrtc.balance) or ratio < settings.rrtc.tree_ratio)
+                {
+                    std::swap(tree_a, tree_b);
+                    tree_a_is_start = not tree_a_is_start;
+                }
+
+                const auto target = sample();
+                if (not target)
+                {
+                    continue;
+                }
+
+                typename Robot::ConfigurationBuffer target_array;
+                target->to_array(target_array.data());
+
+                const auto nearest = tree_a->nearest(NNFloatArray<dimension>{target_array.data()});
+                if (not nearest)
+                {
+                    continue;
+                }
+
+                const auto new_index = extend(tree_a, nearest->first.index, *target).first;
+                if (new_index == nearest->first.index)
+                {
+                    continue;
+                }
+
+                // Extend the other tree toward the new state
+                const auto other_nearest = tree_b->nearest(NNFloatArray<dimension>{buffer_index(new_index)});
+                if (not other_nearest or free_index == max_samples)
+                {
+                    continue;
+                }
+
+                const auto [other_index, connected] =
+                    extend(tree_b, other_nearest->first.index, Configuration(buffer_index(new_index)));
+
+                if (connected)
+                {
+                    // The last node of the other tree is the new state, so the path continues from its parent
+                    auto current = new_index;
+                    result.path.emplace_back(buffer_index(current));
+                    while (parents[current] != current)
+                    {
+                        current = parents[current];
+                        result.path.emplace_back(buffer_index(current));
+                    }
+
+                    std::reverse(result.path.begin(), result.path.end());
+
+                    current = other_index;
+                    while (parents[current] != current)
+                    {
+                        current = parents[current];
+                        result.path.emplace_back(buffer_index(current));
+                    }
+
+                    if (not tree_a_is_start)
+                    {
+                        std::reverse(result.path.begin(), result.path.end());
+                    }
+
+                    result.cost = result.path.cost();
+                    break;
+                }
+            }
+
+            result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+            result.iterations = iter;
+            result.size.emplace_back(start_tree.size());
+            result.size.emplace_back(goal_tree.size());
+            return result;
+        }
+    };
+}  // namespace vamp::planning
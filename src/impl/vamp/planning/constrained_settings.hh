@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <vamp/planning/ik_settings.hh>
+#include <vamp/planning/rrtc_settings.hh>
+
+namespace vamp::planning
+{
+    // Keeps one axis of the end-effector frame (0 for x, 1 for y, 2 for z) within `tolerance` radians of a
+    // direction in the world frame, leaving the rotation about that direction free, e.g., to carry an open
+    // container upright.
+    struct OrientationConstraint
+    {
+        std::size_t axis = 2;
+        std::array<float, 3> direction = {0.F, 0.F, 1.F};
+        float tolerance = 0.05;
+    };
+
+    struct ConstrainedRRTCSettings
+    {
+        // Only the dynamic domain, balance, and limit settings apply. Extensions are bounded by `step`
+        // instead of the range.
+        RRTCSettings rrtc;
+
+        OrientationConstraint constraint;
+
+        // Settings of the projection onto the constraint. The damping, step, and iteration limit settings
+        // apply, and a state that is not projected within `max_iterations` is rejected. The position and
+        // orientation tolerances do not; the tolerance is that of the constraint.
+        IKSettings projection;
+
+        // Largest joint-space distance between consecutive states along the constraint
+        float step = 0.1;
+    };
+}  // namespace vamp::planning
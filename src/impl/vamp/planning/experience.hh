@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/planning/experience_settings.hh>
+#include <vamp/planning/nn.hh>
+#include <vamp/planning/plan.hh>
+#include <vamp/planning/repair.hh>
+#include <vamp/planning/rrtc.hh>
+#include <vamp/planning/simplify.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/random/rng.hh>
+#include <vamp/utils.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    // Database of prior solutions, indexed by the concatenation of their start and goal configurations.
+    template <typename Robot>
+    struct ExperienceDatabase
+    {
+        using Configuration = typename Robot::Configuration;
+        static constexpr auto dimension = Robot::dimension;
+        static constexpr auto key_dimension = 2 * dimension;
+        using Key = FloatVector<key_dimension>;
+
+        // Written at the head of database files, followed by the format version and robot dimension
+        static constexpr std::uint32_t file_magic = 0x50584556;  // "VEXP"
+        static constexpr std::uint32_t file_version = 1;
+
+        ExperienceDatabase() = default;
+        ExperienceDatabase(const ExperienceDatabase &) = delete;
+        auto operator=(const ExperienceDatabase &) -> ExperienceDatabase & = delete;
+
+        // Stores a path, keyed on its first and last configurations
+        inline auto add(const Path<Robot> &path) -> std::size_t
+        {
+            if (path.size() < 2)
+            {
+                throw std::runtime_error("Stored paths must have at least two configurations!");
+            }
+
+            const auto index = paths.size();
+            paths.emplace_back(path);
+
+            auto *key = keys.emplace_back(allocate_key(), &free).get();
+            make_key(key, path.front(), path.back());
+            index_nn.insert(NNNode<key_dimension>{index, {key}});
+
+            return index;
+        }
+
+        // Indices of the (up to) k stored paths closest to the query, ordered by key distance
+        inline auto retrieve(
+            const Configuration &start,
+            const std::vector<Configuration> &goals,
+            std::size_t k) const noexcept -> std::vector<std::pair<std::size_t, std::size_t>>
+        {
+            std::vector<std::tuple<float, std::size_t, std::size_t>> candidates;
+            std::vector<std::pair<NNNode<key_dimension>, float>> neighbors;
+
+            auto key = std::unique_ptr<float, decltype(&free)>(allocate_key(), &free);
+            for (auto i = 0U; i < goals.size(); ++i)
+            {
+                make_key(key.get(), start, goals[i]);
+                index_nn.nearest(
+                    neighbors, NNFloatArray<key_dimension>{key.get()}, k, std::numeric_limits<float>::max());
+
+                for (const auto &[node, distance] : neighbors)
+                {
+                    candidates.emplace_back(distance, node.index, i);
+                }
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+
+            // The same path may be retrieved for several goals; keep only its closest match
+            std::vector<std::pair<std::size_t, std::size_t>> result;
+            for (const auto &[distance, index, goal] : candidates)
+            {
+                if (result.size() == k)
+                {
+                    break;
+                }
+
+                if (std::none_of(
+                        result.cbegin(),
+                        result.cend(),
+                        [index = index](const auto &r) { return r.first == index; }))
+                {
+                    result.emplace_back(index, goal);
+                }
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t
+        {
+            return paths.size();
+        }
+
+        [[nodiscard]] inline auto operator[](std::size_t i) const noexcept -> const Path<Robot> &
+        {
+            return paths[i];
+        }
+
+        inline auto save(const std::string &filename) const noexcept -> bool
+        {
+            std::ofstream file(filename, std::ios::binary);
+            if (not file)
+            {
+                return false;
+            }
+
+            write(file, file_magic);
+            write(file, file_version);
+            write(file, static_cast<std::uint32_t>(dimension));
+            write(file, static_cast<std::uint64_t>(paths.size()));
+
+            for (const auto &path : paths)
+            {
+                write(file, static_cast<std::uint64_t>(path.size()));
+                for (const auto &configuration : path)
+                {
+                    const auto array = configuration.to_array();
+                    file.write(reinterpret_cast<const char *>(array.data()), sizeof(float) * dimension);
+                }
+            }
+
+            return static_cast<bool>(file);
+        }
+
+        // Appends all paths stored in a file to this database, or none of them if the file is malformed
+        inline auto load(const std::string &filename) -> bool
+        {
+            std::ifstream file(filename, std::ios::binary);
+            if (not file)
+            {
+                return false;
+            }
+
+            std::uint32_t magic = 0, version = 0, file_dimension = 0;
+            std::uint64_t n_paths = 0;
+            if (not read(file, magic) or not read(file, version) or not read(file, file_dimension) or
+                not read(file, n_paths) or magic != file_magic or version != file_version or
+                file_dimension != dimension)
+            {
+                return false;
+            }
+
+            std::vector<Path<Robot>> loaded;
+            for (auto i = 0U; i < n_paths; ++i)
+            {
+                std::uint64_t n_states = 0;
+                if (not read(file, n_states) or n_states < 2)
+                {
+                    return false;
+                }
+
+                auto &path = loaded.emplace_back();
+                path.reserve(n_states);
+                for (auto j = 0U; j < n_states; ++j)
+                {
+                    typename Robot::ConfigurationArray array = {};
+                    if (not file.read(reinterpret_cast<char *>(array.data()), sizeof(float) * dimension))
+                    {
+                        return false;
+                    }
+
+                    path.emplace_back(array);
+                }
+            }
+
+            for (const auto &path : loaded)
+            {
+                add(path);
+            }
+
+            return true;
+        }
+
+    private:
+        inline static auto allocate_key() noexcept -> float *
+        {
+            return vamp::utils::vector_alloc<float, FloatVectorAlignment, FloatVectorWidth>(
+                Key::num_scalars_rounded);
+        }
+
+        inline static void
+        make_key(float *key, const Configuration &start, const Configuration &goal) noexcept
+        {
+            const auto start_array = start.to_array();
+            const auto goal_array = goal.to_array();
+
+            std::fill_n(key, Key::num_scalars_rounded, 0.F);
+            std::copy_n(start_array.cbegin(), dimension, key);
+            std::copy_n(goal_array.cbegin(), dimension, key + dimension);
+        }
+
+        template <typename T>
+        inline static void write(std::ofstream &file, const T &value) noexcept
+        {
+            file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        inline static auto read(std::ifstream &file, T &value) noexcept -> bool
+        {
+            return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+        }
+
+        std::vector<Path<Robot>> paths;
+        std::vector<std::unique_ptr<float, decltype(&free)>> keys;
+        NN<key_dimension> index_nn;
+    };
+
+    template <typename Robot, std::size_t rake, std::size_t resolution>
+    struct Experience
+    {
+        using Configuration = typename Robot::Configuration;
+        using RNG = typename vamp::rng::RNG<Robot>;
+        using Database = ExperienceDatabase<Robot>;
+
+        inline static auto solve(
+            const Configuration &start,
+            const Configuration &goal,
+            const collision::Environment<FloatVector<rake>> &environment,
+            const ExperienceSettings &settings,
+            Database &database,
+            typename RNG::Ptr rng) noexcept -> PlanningResult<Robot>
+        {
+            return solve(start, std::vector<Configuration>{goal}, environment, settings, database, rng);
+        }
+
+        inline static auto solve(
+            const Configuration &start,
+            const std::vector<Configuration> &goals,
+            const collision::Environment<FloatVector<rake>> &environment,
+            const ExperienceSettings &settings,
+            Database &database,
+            typename RNG::Ptr rng) noexcept -> PlanningResult<Robot>
+        {
+            auto start_time = std::chrono::steady_clock::now();
+
+            PlanningResult<Robot> result;
+            result.size.emplace_back(database.size());
+
+            // Retrieved paths are bridged from the query start to their own start and from their own goal
+            // to the closest query goal
+            const auto retrieved = database.retrieve(start, goals, settings.k);
+
+            std::vector<Path<Robot>> candidates;
+            std::vector<PathValidity> validity;
+            std::vector<std::size_t> n_invalid;
+            candidates.reserve(retrieved.size());
+            validity.reserve(retrieved.size());
+
+            for (const auto &[index, goal] : retrieved)
+            {
+                auto &candidate = candidates.emplace_back();
+                candidate.reserve(database[index].size() + 2);
+                candidate.emplace_back(start);
+                candidate.insert(candidate.end(), database[index].cbegin(), database[index].cend());
+                candidate.emplace_back(goals[goal]);
+
+                const auto &v =
+                    validity.emplace_back(validate_path<Robot, rake, resolution>(candidate, environment));
+                n_invalid.emplace_back(v.invalid_segments().size());
+            }
+
+            std::vector<std::size_t> order(candidates.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(
+                order.begin(),
+                order.end(),
+                [&n_invalid](auto a, auto b) { return n_invalid[a] < n_invalid[b]; });
+
+            // Paths that were reused as-is add nothing new to the database
+            bool reused = false;
+            bool found = false;
+            for (const auto i : order)
+            {
+                if (validity[i].valid())
+                {
+                    result.path = std::move(candidates[i]);
+                    reused = true;
+                    found = true;
+                    break;
+                }
+
+                auto repaired = repair<Robot, rake, resolution>(
+                    candidates[i], validity[i], environment, settings.repair, rng);
+                result.iterations += repaired.iterations;
+
+                if (repaired.path.size() >= 2)
+                {
+                    result.path = std::move(repaired.path);
+                    found = true;
+                    break;
+                }
+            }
+
+            if (not found)
+            {
+                auto planned =
+                    RRTC<Robot, rake, resolution>::solve(start, goals, environment, settings.rrtc, rng);
+                result.iterations += planned.iterations;
+                result.path = std::move(planned.path);
+            }
+
+            if (result.path.size() >= 2)
+            {
+                auto simplified =
+                    simplify<Robot, rake, resolution>(result.path, environment, settings.simplify, rng);
+                result.path = std::move(simplified.path);
+                result.cost = result.path.cost();
+
+                if (settings.store and not reused)
+                {
+                    database.add(result.path);
+                }
+            }
+
+            result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+            return result;
+        }
+    };
+}  // namespace vamp::planning
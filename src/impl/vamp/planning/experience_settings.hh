@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vamp/planning/repair_settings.hh>
+#include <vamp/planning/rrtc_settings.hh>
+#include <vamp/planning/simplify_settings.hh>
+
+namespace vamp::planning
+{
+    struct ExperienceSettings
+    {
+        // Number of prior solutions retrieved from the database per query
+        std::size_t k = 5;
+
+        // Bounded local replanning of invalid spans of retrieved paths
+        RepairSettings repair;
+
+        // Full planner used only when no retrieved path can be repaired
+        RRTCSettings rrtc;
+        SimplifySettings simplify;
+
+        // Insert new and repaired solutions back into the database
+        bool store = true;
+    };
+}  // namespace vamp::planning
@@ -74,9 +74,10 @@ namespace vamp::planning
             const Configuration &goal,
             const collision::Environment<FloatVector<rake>> &environment,
             const RoadmapSettings<NeighborParamsT> &settings,
-            typename RNG::Ptr &rng) noexcept -> PlanningResult<Robot>
+            typename RNG::Ptr &rng,
+            const SolutionCallback<Robot> &on_solution = {}) noexcept -> PlanningResult<Robot>
         {
-            return solve(start, std::vector<Configuration>{goal}, environment, settings, rng);
+            return solve(start, std::vector<Configuration>{goal}, environment, settings, rng, on_solution);
         }
 
         inline static auto solve(
@@ -84,7 +85,8 @@ namespace vamp::planning
             const std::vector<Configuration> &goals,
             const collision::Environment<FloatVector<rake>> &environment,
             const RoadmapSettings<NeighborParamsT> &settings,
-            typename RNG::Ptr &rng) noexcept -> PlanningResult<Robot>
+            typename RNG::Ptr &rng,
+            const SolutionCallback<Robot> &on_solution = {}) noexcept -> PlanningResult<Robot>
         {
             auto start_time = std::chrono::steady_clock::now();
 
@@ -133,6 +135,9 @@ namespace vamp::planning
             Configuration temp_config_self;
             std::vector<QueueEdge> open_set;
 
+            // Cost of the last solution reported to the callback
+            float reported_cost = std::numeric_limits<float>::infinity();
+
             // Search until Initial Solution
             while (nodes.size() < settings.max_samples and iter++ < settings.max_iterations)
             {
@@ -313,6 +318,19 @@ namespace vamp::planning
                     }
                 }
 
+                // Report an improved solution, whose path is only recovered if there is a callback
+                if (on_solution and nodes[1].g < reported_cost)
+                {
+                    reported_cost = nodes[1].g;
+
+                    Path<Robot> path;
+                    utils::recover_path<Robot>(parents, state_index, path);
+                    if (on_solution(path, reported_cost))
+                    {
+                        break;
+                    }
+                }
+
                 // If we have a solution and just want an initial solution, break
                 if (not settings.optimize and parents[1] != std::numeric_limits<unsigned int>::max())
                 {
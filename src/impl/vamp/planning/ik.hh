@@ -0,0 +1,211 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <vamp/planning/ik_settings.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    // End-effector poses of a block of configurations, one per lane, as the translation followed by the
+    // column-major rotation, as returned by Robot::eefk()
+    template <std::size_t rake>
+    using Pose = std::array<FloatVector<rake>, 12>;
+
+    // Displacement between poses of each lane, as the translation followed by the rotation vector
+    template <std::size_t rake>
+    using PoseError = std::array<FloatVector<rake>, 6>;
+
+    // Jacobian of the end-effector pose of each lane, with one row per element of PoseError
+    template <typename Robot, std::size_t rake>
+    using Jacobian = std::array<std::array<FloatVector<rake>, Robot::dimension>, 6>;
+
+    // Displacement from `pose` to `target`. The rotation is half the sum of the cross products of matching
+    // axes, which is the rotation vector between them for small rotations and points the same way for
+    // larger ones.
+    template <std::size_t rake>
+    inline auto pose_error(const Pose<rake> &pose, const Pose<rake> &target) noexcept -> PoseError<rake>
+    {
+        PoseError<rake> error;
+        for (auto k = 0U; k < 3; ++k)
+        {
+            error[k] = target[k] - pose[k];
+            error[3 + k] = FloatVector<rake>::fill(0.F);
+        }
+
+        for (auto axis = 3U; axis < 12; axis += 3)
+        {
+            const auto *a = &pose[axis];
+            const auto *b = &target[axis];
+            error[3] = error[3] + (a[1] * b[2] - a[2] * b[1]) * 0.5F;
+            error[4] = error[4] + (a[2] * b[0] - a[0] * b[2]) * 0.5F;
+            error[5] = error[5] + (a[0] * b[1] - a[1] * b[0]) * 0.5F;
+        }
+
+        return error;
+    }
+
+    // Jacobian of each lane at `block`, whose poses are `pose`, by forward differences. Every lane's column
+    // for a joint comes from the same vectorized forward kinematics, so a block costs one call per joint.
+    template <typename Robot, std::size_t rake>
+    inline auto jacobian(
+        const typename Robot::template ConfigurationBlock<rake> &block,
+        const Pose<rake> &pose,
+        float step) noexcept -> Jacobian<Robot, rake>
+    {
+        Jacobian<Robot, rake> result;
+
+        auto perturbed = block;
+        for (auto j = 0U; j < Robot::dimension; ++j)
+        {
+            perturbed[j] = block[j] + step;
+            const auto difference = pose_error<rake>(pose, Robot::template eefk<rake>(perturbed));
+            for (auto k = 0U; k < 6; ++k)
+            {
+                result[k][j] = difference[k] * (1.F / step);
+            }
+
+            perturbed[j] = block[j];
+        }
+
+        return result;
+    }
+
+    // Damped least-squares step J^T (J J^T + damping^2 I)^-1 error of each lane, solving the 6x6 system by a
+    // Cholesky factorization across lanes. Rows of the Jacobian and error that are zero are left free.
+    template <typename Robot, std::size_t rake>
+    inline auto
+    dls_step(const Jacobian<Robot, rake> &J, const PoseError<rake> &error, float damping) noexcept
+        -> std::array<FloatVector<rake>, Robot::dimension>
+    {
+        using VectorT = FloatVector<rake>;
+
+        std::array<std::array<VectorT, 6>, 6> L;
+        std::array<VectorT, 6> inverse_diagonal;
+        for (auto a = 0U; a < 6; ++a)
+        {
+            for (auto b = 0U; b <= a; ++b)
+            {
+                auto s = VectorT::fill((a == b) ? damping * damping : 0.F);
+                for (auto j = 0U; j < Robot::dimension; ++j)
+                {
+                    s = s + J[a][j] * J[b][j];
+                }
+
+                for (auto m = 0U; m < b; ++m)
+                {
+                    s = s - L[a][m] * L[b][m];
+                }
+
+                if (a == b)
+                {
+                    L[a][a] = s.sqrt();
+                    inverse_diagonal[a] = VectorT::fill(1.F) / L[a][a];
+                }
+                else
+                {
+                    L[a][b] = s * inverse_diagonal[b];
+                }
+            }
+        }
+
+        std::array<VectorT, 6> y;
+        for (auto a = 0U; a < 6; ++a)
+        {
+            auto s = error[a];
+            for (auto m = 0U; m < a; ++m)
+            {
+                s = s - L[a][m] * y[m];
+            }
+
+            y[a] = s * inverse_diagonal[a];
+        }
+
+        for (auto a = 6U; a-- > 0;)
+        {
+            auto s = y[a];
+            for (auto m = a + 1; m < 6; ++m)
+            {
+                s = s - L[m][a] * y[m];
+            }
+
+            y[a] = s * inverse_diagonal[a];
+        }
+
+        std::array<VectorT, Robot::dimension> step;
+        for (auto j = 0U; j < Robot::dimension; ++j)
+        {
+            step[j] = J[0][j] * y[0];
+            for (auto a = 1U; a < 6; ++a)
+            {
+                step[j] = step[j] + J[a][j] * y[a];
+            }
+        }
+
+        return step;
+    }
+
+    // Moves each lane of `block` by `step`, shortened to at most max_step and clamped to `lows` and `highs`,
+    // except for the lanes set in `frozen`
+    template <typename Robot, std::size_t rake>
+    inline void take_step(
+        typename Robot::template ConfigurationBlock<rake> &block,
+        const std::array<FloatVector<rake>, Robot::dimension> &step,
+        const typename Robot::ConfigurationArray &lows,
+        const typename Robot::ConfigurationArray &highs,
+        const FloatVector<rake> &frozen,
+        const IKSettings &settings) noexcept
+    {
+        using VectorT = FloatVector<rake>;
+
+        auto norm = step[0] * step[0];
+        for (auto j = 1U; j < Robot::dimension; ++j)
+        {
+            norm = norm + step[j] * step[j];
+        }
+
+        const auto scale = (VectorT::fill(settings.max_step) / norm.sqrt()).clamp(0.F, 1.F);
+        for (auto j = 0U; j < Robot::dimension; ++j)
+        {
+            const VectorT moved = (block[j] + step[j] * scale).clamp(lows[j], highs[j]);
+            block[j] = moved.blend(block[j], frozen);
+        }
+    }
+
+    // Moves each lane of `block` toward the pose in the same lane of `target` by damped least squares,
+    // within the joint limits of the robot instance bound to this thread. Lanes stop moving once they
+    // converge. Returns the mask of lanes that converged; the others are left at their last iterate.
+    template <typename Robot, std::size_t rake>
+    inline auto solve_ik(
+        typename Robot::template ConfigurationBlock<rake> &block,
+        const Pose<rake> &target,
+        const IKSettings &settings) noexcept -> FloatVector<rake>
+    {
+        const auto &instance = robots::Instance<Robot>::current();
+        const auto lows = instance.lows();
+        const auto highs = instance.highs();
+
+        const auto position_tolerance = settings.position_tolerance * settings.position_tolerance;
+        const auto orientation_tolerance = settings.orientation_tolerance * settings.orientation_tolerance;
+
+        for (auto iteration = 0U;; ++iteration)
+        {
+            const auto pose = Robot::template eefk<rake>(block);
+            const auto error = pose_error<rake>(pose, target);
+
+            const auto converged =
+                ((error[0] * error[0] + error[1] * error[1] + error[2] * error[2]) <= position_tolerance) &
+                ((error[3] * error[3] + error[4] * error[4] + error[5] * error[5]) <= orientation_tolerance);
+            if (converged.all() or iteration == settings.max_iterations)
+            {
+                return converged;
+            }
+
+            const auto J = jacobian<Robot, rake>(block, pose, settings.jacobian_step);
+            const auto step = dls_step<Robot, rake>(J, error, settings.damping);
+            take_step<Robot, rake>(block, step, lows, highs, converged, settings);
+        }
+    }
+}  // namespace vamp::planning
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+namespace vamp::planning
+{
+    struct IKSettings
+    {
+        // A lane has converged once its end-effector is within these tolerances of its target, in meters and
+        // radians
+        float position_tolerance = 0.001;
+        float orientation_tolerance = 0.01;
+
+        // Damping of the least-squares steps, which keeps steps bounded near singularities
+        float damping = 0.05;
+
+        // Largest joint-space step of one iteration
+        float max_step = 0.2;
+
+        // Joint offset of the finite differences that estimate the Jacobian
+        float jacobian_step = 0.001;
+
+        std::size_t max_iterations = 50;
+    };
+}  // namespace vamp::planning
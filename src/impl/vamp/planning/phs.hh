@@ -1,6 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <memory>
+#include <vector>
 
 #include <Eigen/Core>
 #include <Eigen/LU>
@@ -8,6 +12,7 @@
 
 #include <vamp/random/distribution.hh>
 #include <vamp/random/rng.hh>
+#include <vamp/robots/instance.hh>
 #include <vamp/planning/roadmap.hh>
 #include <vamp/vector/eigen.hh>
 #include <vamp/vector.hh>
@@ -158,14 +163,21 @@ namespace vamp::planning
             rng->dist.reset();
         }
 
+        inline auto fork() noexcept -> typename vamp::rng::RNG<Robot>::Ptr override
+        {
+            auto forked = rng->fork();
+            return std::make_shared<ProlateHyperspheroidRNG<Robot>>(phs, forked);
+        }
+
         inline auto next() noexcept -> FloatVector<Robot::dimension> override
         {
             auto x = phs.transform(uniform_in_ball());
 
             // Clamp values
-            Robot::descale_configuration(x);
-            x.clamp(0.F, 1.F);
-            Robot::scale_configuration(x);
+            const auto &instance = robots::Instance<Robot>::current();
+            instance.descale_configuration(x);
+            x = x.clamp(0.F, 1.F);
+            instance.scale_configuration(x);
 
             return x;
         }
@@ -173,7 +185,7 @@ namespace vamp::planning
         inline auto logit() noexcept -> vamp::FloatVector<Robot::dimension>
         {
             auto U1 = rng->next();
-            Robot::descale_configuration(U1);
+            robots::Instance<Robot>::current().descale_configuration(U1);
             return (U1 * (1 - U1).rcp()).log() * std::sqrt(vamp::utils::constants::pi / 8.F);
         }
 
@@ -193,4 +205,190 @@ namespace vamp::planning
         typename vamp::rng::RNG<Robot>::Ptr rng;
     };
 
+    // Samples the union of the informed sets of several goals, i.e., one PHS per goal with the start and
+    // that goal as foci. A PHS is picked in proportion to its measure and sampled uniformly, and the sample
+    // is then kept with probability 1 / (number of PHSs containing it) so that overlapping regions are not
+    // sampled more densely. Candidates are drawn a block at a time, and their membership in each PHS is
+    // counted across the whole block at once.
+    template <typename Robot>
+    struct MultiProlateHyperspheroidRNG : public rng::RNG<Robot>
+    {
+        static constexpr auto dimension = Robot::dimension;
+        static constexpr auto block_size = FloatVectorWidth;
+        using Configuration = FloatVector<dimension>;
+        using Lanes = FloatVector<block_size>;
+
+        MultiProlateHyperspheroidRNG(
+            const Configuration &start,
+            const std::vector<Configuration> &goals,
+            typename vamp::rng::RNG<Robot>::Ptr &rng)
+          : rng(rng)
+        {
+            const auto start_array = start.to_array();
+            std::copy_n(start_array.cbegin(), dimension, start_coordinates.begin());
+
+            samplers.reserve(goals.size());
+            goal_coordinates.resize(goals.size());
+            for (auto i = 0U; i < goals.size(); ++i)
+            {
+                samplers.emplace_back(ProlateHyperspheroid<Robot>(start, goals[i]), rng);
+
+                const auto goal_array = goals[i].to_array();
+                std::copy_n(goal_array.cbegin(), dimension, goal_coordinates[i].begin());
+            }
+        }
+
+        // Shrinks every PHS to a new best cost. Goals that are at least this far from the start cannot lead
+        // to a better solution and are no longer sampled.
+        inline void set_transverse_diameter(float transverse_diameter_in) noexcept
+        {
+            transverse_diameter = transverse_diameter_in;
+
+            active.clear();
+            cumulative_measures.clear();
+            float total = 0.F;
+            for (auto i = 0U; i < samplers.size(); ++i)
+            {
+                auto &phs = samplers[i].phs;
+                if (phs.get_min_transverse_diameter() < transverse_diameter)
+                {
+                    phs.set_transverse_diameter(transverse_diameter);
+                    total += phs.measure();
+
+                    active.emplace_back(i);
+                    cumulative_measures.emplace_back(total);
+                }
+            }
+
+            // Samples drawn for the old bound are not uniform in the new union
+            pending.clear();
+        }
+
+        // Indices of the goals whose PHS is still sampled
+        inline auto active_goals() const noexcept -> const std::vector<std::size_t> &
+        {
+            return active;
+        }
+
+        inline void reset() noexcept override
+        {
+            rng->reset();
+            rng->dist.reset();
+            pending.clear();
+        }
+
+        inline auto fork() noexcept -> typename vamp::rng::RNG<Robot>::Ptr override
+        {
+            auto forked = std::make_shared<MultiProlateHyperspheroidRNG<Robot>>(*this);
+            forked->rng = rng->fork();
+            for (auto &sampler : forked->samplers)
+            {
+                sampler.rng = forked->rng;
+            }
+
+            return forked;
+        }
+
+        inline auto next() noexcept -> Configuration override
+        {
+            // Only possible once the bound reaches the straight-line cost of every goal
+            if (active.empty())
+            {
+                return rng->next();
+            }
+
+            // Nothing to weight, as there is no overlap
+            if (active.size() == 1)
+            {
+                return samplers[active.front()].next();
+            }
+
+            while (pending.empty())
+            {
+                refill();
+            }
+
+            const auto x = pending.back();
+            pending.pop_back();
+            return x;
+        }
+
+        typename vamp::rng::RNG<Robot>::Ptr rng;
+
+    private:
+        inline auto pick() noexcept -> std::size_t
+        {
+            const auto u = rng->dist.uniform_01() * cumulative_measures.back();
+            const auto it = std::upper_bound(cumulative_measures.cbegin(), cumulative_measures.cend(), u);
+            return active[std::min(
+                static_cast<std::size_t>(it - cumulative_measures.cbegin()), cumulative_measures.size() - 1)];
+        }
+
+        inline static auto
+        distances(const std::array<Lanes, dimension> &block, const std::array<float, dimension> &to) noexcept
+            -> Lanes
+        {
+            auto sum = Lanes::fill(0.F);
+            for (auto j = 0U; j < dimension; ++j)
+            {
+                const auto d = block[j] - to[j];
+                sum = sum + d * d;
+            }
+
+            return sum.sqrt();
+        }
+
+        inline void refill() noexcept
+        {
+            std::array<Configuration, block_size> candidates;
+            std::array<typename Robot::ConfigurationBuffer, block_size> arrays;
+            for (auto i = 0U; i < block_size; ++i)
+            {
+                candidates[i] = samplers[pick()].next();
+                candidates[i].to_array(arrays[i]);
+            }
+
+            // Transpose the candidates so each lane holds one of them
+            std::array<Lanes, dimension> block;
+            for (auto j = 0U; j < dimension; ++j)
+            {
+                std::array<float, block_size> lanes;
+                for (auto i = 0U; i < block_size; ++i)
+                {
+                    lanes[i] = arrays[i][j];
+                }
+
+                block[j] = Lanes(lanes);
+            }
+
+            const auto to_start = distances(block, start_coordinates);
+
+            auto count = Lanes::fill(0.F);
+            for (const auto i : active)
+            {
+                const auto inside = (to_start + distances(block, goal_coordinates[i])) < transverse_diameter;
+                count = count + (inside & 1.F);
+            }
+
+            // A sample clamped to the joint limits (or on a boundary) may be in no PHS at all
+            const auto counts = count.max(1.F).to_array();
+            for (auto i = 0U; i < block_size; ++i)
+            {
+                if (rng->dist.uniform_01() * counts[i] < 1.F)
+                {
+                    pending.emplace_back(candidates[i]);
+                }
+            }
+        }
+
+        std::array<float, dimension> start_coordinates;
+        std::vector<std::array<float, dimension>> goal_coordinates;
+        std::vector<ProlateHyperspheroidRNG<Robot>> samplers;
+
+        float transverse_diameter{0.};
+        std::vector<std::size_t> active;
+        std::vector<float> cumulative_measures;
+        std::vector<Configuration> pending;
+    };
+
 }  // namespace vamp::planning
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <limits>
 #include <vamp/planning/validate.hh>
 #include <vamp/planning/nn.hh>
@@ -178,6 +179,12 @@ namespace vamp::planning
         std::vector<std::size_t> size;
     };
 
+    // Called by anytime planners with each solution that improves on the last, and its cost, e.g., so that
+    // execution can begin on the first solution and switch to better ones as they are found. Returning true
+    // stops the search, which then returns this solution. Called between searches, not within them.
+    template <typename Robot>
+    using SolutionCallback = std::function<bool(const Path<Robot> &, float)>;
+
     template <typename Robot>
     struct Roadmap
     {
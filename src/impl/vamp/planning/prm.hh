@@ -23,7 +23,8 @@ namespace vamp::planning
         typename Robot,
         std::size_t rake,
         std::size_t resolution,
-        typename NeighborParamsT = PRMStarNeighborParams>
+        typename NeighborParamsT = PRMStarNeighborParams,
+        typename NNT = NN<Robot::dimension>>
     struct PRM
     {
         using Configuration = typename Robot::Configuration;
@@ -49,7 +50,7 @@ namespace vamp::planning
         {
             PlanningResult<Robot> result;
 
-            NN<dimension> roadmap;
+            NNT roadmap;
 
             auto start_time = std::chrono::steady_clock::now();
 
@@ -202,7 +203,7 @@ namespace vamp::planning
             const RoadmapSettings<NeighborParamsT> &settings,
             typename RNG::Ptr rng) noexcept -> Roadmap<Robot>
         {
-            NN<dimension> roadmap;
+            NNT roadmap;
 
             constexpr const unsigned int start_index = 0;
             constexpr const unsigned int goal_index = 1;
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/planning/plan.hh>
+#include <vamp/planning/repair_settings.hh>
+#include <vamp/planning/rrtc.hh>
+#include <vamp/planning/simplify.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/random/rng.hh>
+#include <vamp/utils.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    struct PathValidity
+    {
+        std::vector<bool> waypoints;
+        std::vector<bool> segments;
+
+        [[nodiscard]] inline auto valid() const noexcept -> bool
+        {
+            return std::all_of(waypoints.cbegin(), waypoints.cend(), [](bool v) { return v; }) and
+                   std::all_of(segments.cbegin(), segments.cend(), [](bool v) { return v; });
+        }
+
+        [[nodiscard]] inline auto invalid_segments() const noexcept -> std::vector<std::size_t>
+        {
+            std::vector<std::size_t> invalid;
+            for (auto i = 0U; i < segments.size(); ++i)
+            {
+                if (not segments[i])
+                {
+                    invalid.emplace_back(i);
+                }
+            }
+
+            return invalid;
+        }
+    };
+
+    // Waypoints are checked together in raked blocks, so only segments between two valid waypoints need
+    // their own motion validation
+    template <typename Robot, std::size_t rake, std::size_t resolution>
+    inline auto
+    validate_path(const Path<Robot> &path, const collision::Environment<FloatVector<rake>> &environment)
+        -> PathValidity
+    {
+        PathValidity validity;
+        validity.waypoints = validate_configurations<Robot, rake>(path, environment);
+        validity.segments.resize((path.size() > 1) ? path.size() - 1 : 0, false);
+
+        for (auto i = 0U; i < validity.segments.size(); ++i)
+        {
+            validity.segments[i] =
+                validity.waypoints[i] and validity.waypoints[i + 1] and
+                validate_motion<Robot, rake, resolution>(path[i], path[i + 1], environment);
+        }
+
+        return validity;
+    }
+
+    template <typename Robot, std::size_t rake, std::size_t resolution>
+    inline auto repair(
+        const Path<Robot> &path,
+        const PathValidity &validity,
+        const collision::Environment<FloatVector<rake>> &environment,
+        const RepairSettings &settings,
+        const typename vamp::rng::RNG<Robot>::Ptr rng) -> PlanningResult<Robot>
+    {
+        auto start_time = std::chrono::steady_clock::now();
+
+        PlanningResult<Robot> result;
+
+        // Each run of invalid segments and waypoints is replanned between the nearest valid waypoints
+        // around it
+        std::vector<std::pair<std::size_t, std::size_t>> spans;
+        for (std::size_t i = 0; i < validity.segments.size(); ++i)
+        {
+            if (validity.segments[i] or (not spans.empty() and i < spans.back().second))
+            {
+                continue;
+            }
+
+            auto a = i;
+            while (a > 0 and not validity.waypoints[a])
+            {
+                --a;
+            }
+
+            auto b = i + 1;
+            while (b < path.size() - 1 and not validity.waypoints[b])
+            {
+                ++b;
+            }
+
+            if (not validity.waypoints[a] or not validity.waypoints[b])
+            {
+                result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+                return result;
+            }
+
+            if (not spans.empty() and a < spans.back().second)
+            {
+                spans.back().second = std::max(spans.back().second, b);
+            }
+            else
+            {
+                spans.emplace_back(a, b);
+            }
+        }
+
+        auto rrtc_settings = settings.rrtc;
+        rrtc_settings.max_iterations = settings.max_iterations;
+        rrtc_settings.max_samples = settings.max_samples;
+
+        // Replanned spans, as indices into the repaired path
+        std::vector<std::pair<std::size_t, std::size_t>> repaired;
+
+        std::size_t next = 0;
+        for (const auto &[a, b] : spans)
+        {
+            result.path.insert(result.path.end(), path.cbegin() + next, path.cbegin() + a);
+
+            auto local =
+                RRTC<Robot, rake, resolution>::solve(path[a], path[b], environment, rrtc_settings, rng);
+            result.iterations += local.iterations;
+
+            if (local.path.size() < 2)
+            {
+                result.path.clear();
+                result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+                return result;
+            }
+
+            repaired.emplace_back(result.path.size(), result.path.size() + local.path.size() - 1);
+            result.path.insert(result.path.end(), local.path.cbegin(), local.path.cend() - 1);
+            next = b;
+        }
+
+        result.path.insert(result.path.end(), path.cbegin() + next, path.cend());
+        result.size.emplace_back(spans.size());
+
+        if (settings.simplify_local and not repaired.empty())
+        {
+            // Widen each span by its context and merge overlapping windows, then simplify back to front so
+            // that earlier indices stay put
+            std::vector<std::pair<std::size_t, std::size_t>> windows;
+            for (const auto &[a, b] : repaired)
+            {
+                const auto wa = (a > settings.context) ? a - settings.context : 0;
+                const auto wb = std::min(b + settings.context, result.path.size() - 1);
+
+                if (not windows.empty() and wa <= windows.back().second)
+                {
+                    windows.back().second = wb;
+                }
+                else
+                {
+                    windows.emplace_back(wa, wb);
+                }
+            }
+
+            for (auto it = windows.crbegin(); it != windows.crend(); ++it)
+            {
+                const auto &[wa, wb] = *it;
+
+                Path<Robot> local;
+                local.insert(local.end(), result.path.cbegin() + wa, result.path.cbegin() + wb + 1);
+
+                auto simplified =
+                    simplify<Robot, rake, resolution>(local, environment, settings.simplify, rng);
+                result.iterations += simplified.iterations;
+
+                result.path.erase(result.path.begin() + wa, result.path.begin() + wb + 1);
+                result.path.insert(
+                    result.path.begin() + wa, simplified.path.cbegin(), simplified.path.cend());
+            }
+        }
+
+        result.cost = result.path.cost();
+        result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+        return result;
+    }
+
+    template <typename Robot, std::size_t rake, std::size_t resolution>
+    inline auto repair(
+        const Path<Robot> &path,
+        const collision::Environment<FloatVector<rake>> &environment,
+        const RepairSettings &settings,
+        const typename vamp::rng::RNG<Robot>::Ptr rng) -> PlanningResult<Robot>
+    {
+        auto start_time = std::chrono::steady_clock::now();
+
+        const auto validity = validate_path<Robot, rake, resolution>(path, environment);
+        if (validity.valid())
+        {
+            PlanningResult<Robot> result;
+            result.path = path;
+            result.cost = path.cost();
+            result.size.emplace_back(0);
+            result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+            return result;
+        }
+
+        auto result = repair<Robot, rake, resolution>(path, validity, environment, settings, rng);
+        result.nanoseconds = vamp::utils::get_elapsed_nanoseconds(start_time);
+        return result;
+    }
+}  // namespace vamp::planning
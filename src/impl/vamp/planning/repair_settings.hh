@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vamp/planning/rrtc_settings.hh>
+#include <vamp/planning/simplify_settings.hh>
+
+namespace vamp::planning
+{
+    struct RepairSettings
+    {
+        // Settings of the original solve, reused for each local replan
+        RRTCSettings rrtc;
+
+        // Bounds on each local replan, overriding those in rrtc
+        std::size_t max_iterations = 1000;
+        std::size_t max_samples = 1000;
+
+        // Re-simplify each repaired span together with this many neighboring waypoints on either side
+        bool simplify_local = true;
+        std::size_t context = 1;
+        SimplifySettings simplify;
+    };
+}  // namespace vamp::planning
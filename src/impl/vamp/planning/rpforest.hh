@@ -0,0 +1,244 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <vamp/planning/nn.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    // Approximate nearest neighbors in a forest of random projection trees, as a drop-in replacement for
+    // NN<dimension> in high dimensions, where kd-trees degrade toward linear scans. Each tree splits its
+    // leaves at the median of their states along a random direction once they hold more than `leaf_size`
+    // states, and a query scans the leaf it falls in in each of the `trees` trees. More trees or larger
+    // leaves raise recall at the cost of more distance computations; any state of a scanned leaf is a
+    // candidate, so the nearest state found is often, but not always, the true nearest. Inserting only
+    // descends the trees, which keeps it cheap for incremental planners. Nodes must point to states padded
+    // to FloatVector<dimension>, as in the planners' buffers, so projections and distances are computed in
+    // SIMD.
+    template <std::size_t dimension, std::size_t trees = 4, std::size_t leaf_size = 32>
+    class RPForest
+    {
+    public:
+        using Node = NNNode<dimension>;
+        using Key = NNFloatArray<dimension>;
+
+        RPForest()
+        {
+            for (auto &tree : forest)
+            {
+                tree.emplace_back();
+            }
+        }
+
+        inline void insert(const Node &node)
+        {
+            const auto index = static_cast<unsigned int>(nodes.size());
+            nodes.emplace_back(node);
+            visited.emplace_back(0);
+
+            const auto state = FloatVector<dimension>(node.array.v);
+            for (auto &tree : forest)
+            {
+                const auto cell = descend(tree, state);
+                tree[cell].members.emplace_back(index);
+                if (tree[cell].members.size() > std::max(leaf_size, tree[cell].retry))
+                {
+                    split(tree, cell);
+                }
+            }
+        }
+
+        [[nodiscard]] inline auto nearest(const Key &key) const -> std::optional<std::pair<Node, float>>
+        {
+            if (nodes.empty())
+            {
+                return std::nullopt;
+            }
+
+            const auto query = FloatVector<dimension>(key.v);
+            auto best = std::make_pair(std::numeric_limits<float>::max(), 0U);
+            scan(query, [&best](float d, unsigned int index) { best = std::min(best, {d, index}); });
+
+            return std::make_pair(nodes[best.second], std::sqrt(best.first));
+        }
+
+        // Up to `k` nodes within `r` of `key`, closest first
+        inline void nearest(
+            std::vector<std::pair<Node, float>> &result,
+            const Key &key,
+            std::size_t k,
+            float r) const
+        {
+            result.clear();
+            if (nodes.empty() or k == 0)
+            {
+                return;
+            }
+
+            const auto query = FloatVector<dimension>(key.v);
+            const auto r2 = r * r;
+
+            candidates.clear();
+            scan(
+                query,
+                [this, r2](float d, unsigned int index)
+                {
+                    if (d <= r2)
+                    {
+                        candidates.emplace_back(d, index);
+                    }
+                });
+
+            const auto n = std::min(k, candidates.size());
+            std::partial_sort(candidates.begin(), candidates.begin() + n, candidates.end());
+            for (auto i = 0U; i < n; ++i)
+            {
+                result.emplace_back(nodes[candidates[i].second], std::sqrt(candidates[i].first));
+            }
+        }
+
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t
+        {
+            return nodes.size();
+        }
+
+    private:
+        // Leaves hold their members; internal cells hold their split and the index of their first child,
+        // with the second right after it
+        struct Cell
+        {
+            FloatVector<dimension> direction;
+            float threshold = 0.F;
+            unsigned int children = 0;
+            std::vector<unsigned int> members;
+
+            // Size past which a leaf that failed to split tries again
+            std::size_t retry = 0;
+        };
+
+        using Tree = std::vector<Cell>;
+
+        [[nodiscard]] inline auto project(const FloatVector<dimension> &direction, unsigned int index) const
+            noexcept -> float
+        {
+            return (direction * FloatVector<dimension>(nodes[index].array.v)).hsum();
+        }
+
+        [[nodiscard]] inline static auto
+        descend(const Tree &tree, const FloatVector<dimension> &state) noexcept -> std::size_t
+        {
+            std::size_t cell = 0;
+            while (tree[cell].children != 0)
+            {
+                const auto &split = tree[cell];
+                cell = split.children + ((split.direction * state).hsum() > split.threshold ? 1 : 0);
+            }
+
+            return cell;
+        }
+
+        // Calls `f` with the squared distance and index of each state in the leaves that `query` falls in,
+        // once each
+        template <typename F>
+        inline void scan(const FloatVector<dimension> &query, const F &f) const
+        {
+            if (++epoch == 0)
+            {
+                std::fill(visited.begin(), visited.end(), 0);
+                epoch = 1;
+            }
+
+            for (const auto &tree : forest)
+            {
+                for (const auto index : tree[descend(tree, query)].members)
+                {
+                    if (visited[index] != epoch)
+                    {
+                        visited[index] = epoch;
+                        f((FloatVector<dimension>(nodes[index].array.v) - query).squared_l2_norm(), index);
+                    }
+                }
+            }
+        }
+
+        // Directions are drawn from a hash of the number of splits so far, so that planners remain
+        // deterministic for a given sequence of samples
+        [[nodiscard]] inline auto random_direction() noexcept -> FloatVector<dimension>
+        {
+            alignas(FloatVectorAlignment)
+                std::array<float, FloatVector<dimension>::num_scalars_rounded> direction = {};
+            for (auto i = 0U; i < dimension; ++i)
+            {
+                std::uint64_t z = (splits * dimension + i) + 0x9E3779B97F4A7C15ULL;
+                z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+                z = z ^ (z >> 31U);
+                direction[i] = static_cast<float>(z >> 40U) * 0x1.0p-24F - 0.5F;
+            }
+
+            ++splits;
+            return FloatVector<dimension>(direction.data());
+        }
+
+        // Splits the leaf `cell` at the median of its members along a random direction
+        inline void split(Tree &tree, std::size_t cell)
+        {
+            auto direction = random_direction();
+
+            std::vector<std::pair<float, unsigned int>> projected;
+            projected.reserve(tree[cell].members.size());
+            for (const auto index : tree[cell].members)
+            {
+                projected.emplace_back(project(direction, index), index);
+            }
+
+            const auto middle = projected.begin() + projected.size() / 2;
+            std::nth_element(projected.begin(), middle, projected.end());
+            const auto threshold = middle->first;
+
+            // Members at the median go left, so a leaf of mostly duplicate states cannot be split. It tries
+            // again with a new direction once it has doubled, so that inserting into it stays amortized
+            // constant time instead of projecting the whole leaf every time.
+            const auto right = std::any_of(
+                projected.cbegin(), projected.cend(), [&](const auto &p) { return p.first > threshold; });
+            if (not right)
+            {
+                tree[cell].retry = 2 * projected.size();
+                return;
+            }
+
+            const auto children = static_cast<unsigned int>(tree.size());
+            tree.emplace_back();
+            tree.emplace_back();
+
+            for (const auto &[p, index] : projected)
+            {
+                tree[children + ((p > threshold) ? 1 : 0)].members.emplace_back(index);
+            }
+
+            auto &split = tree[cell];
+            split.direction = direction;
+            split.threshold = threshold;
+            split.children = children;
+            split.members = {};
+        }
+
+        std::vector<Node> nodes;
+        std::array<Tree, trees> forest;
+        std::size_t splits = 0;
+
+        // States seen by the current query, marked with its epoch to avoid clearing between queries
+        mutable std::vector<unsigned int> visited;
+        mutable unsigned int epoch = 0;
+        mutable std::vector<std::pair<float, unsigned int>> candidates;
+    };
+}  // namespace vamp::planning
@@ -13,7 +13,7 @@
 
 namespace vamp::planning
 {
-    template <typename Robot, std::size_t rake, std::size_t resolution>
+    template <typename Robot, std::size_t rake, std::size_t resolution, typename NNT = NN<Robot::dimension>>
     struct RRTC
     {
         using Configuration = typename Robot::Configuration;
@@ -39,8 +39,8 @@ namespace vamp::planning
         {
             PlanningResult<Robot> result;
 
-            NN<dimension> start_tree;
-            NN<dimension> goal_tree;
+            NNT start_tree;
+            NNT goal_tree;
 
             constexpr const std::size_t start_index = 0;
 
@@ -170,13 +170,17 @@ namespace vamp::planning
                     const float increment_length = other_nearest_distance / static_cast<float>(n_extensions);
                     auto increment = other_nearest_vector * (1.0F / static_cast<float>(n_extensions));
 
+                    // Nodes are only added for the valid prefix of the increments that fit in the tree
+                    const auto n_valid = validate_connect<Robot, rake, resolution>(
+                        new_configuration,
+                        increment,
+                        increment_length,
+                        std::min(n_extensions, settings.max_samples - free_index),
+                        environment);
+
                     std::size_t i_extension = 0;
                     auto prior = new_configuration;
-                    for (; i_extension < n_extensions and
-                           validate_vector<Robot, rake, resolution>(
-                               prior, increment, increment_length, environment) and
-                           free_index < settings.max_samples;
-                         ++i_extension)
+                    for (; i_extension < n_valid; ++i_extension)
                     {
                         auto next = prior + increment;
                         float *next_index = buffer_index(free_index);
@@ -7,6 +7,7 @@
 #include <vamp/planning/plan.hh>
 #include <vamp/planning/validate.hh>
 #include <vamp/random/rng.hh>
+#include <vamp/robots/instance.hh>
 #include <vamp/vector.hh>
 
 namespace vamp::planning
@@ -169,7 +170,7 @@ namespace vamp::planning
             for (auto attempt = 0U; attempt < settings.perturbation_attempts; ++attempt)
             {
                 auto perturbation = rng->next();
-                Robot::scale_configuration(perturbation);
+                robots::Instance<Robot>::current().scale_configuration(perturbation);
 
                 const auto new_state = perturb_state.interpolate(perturbation, settings.range);
                 float new_cost = new_state.distance(before_state) + new_state.distance(after_state);
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <vamp/collision/capt.hh>
+#include <vamp/collision/environment.hh>
+#include <vamp/planning/plan.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::planning
+{
+    // Computes the volume swept by the robot's collision spheres along a path, sampled at exactly the
+    // configurations that validate_vector() checks, and returns it as an environment of pointclouds: one CAPT
+    // per distinct sphere radius, so that each point carries the exact radius of the sphere it came from.
+    //
+    // The result is an ordinary environment, so other robots' configurations, motions, and plans can be
+    // checked against the committed path directly (e.g., with fkcc() or validate_motion()), as can obstacle
+    // spheres against each of its pointclouds. Queries must use radii in [r_min, r_max].
+    template <typename Robot, std::size_t rake, std::size_t resolution>
+    inline auto sweep(const Path<Robot> &path, float r_min, float r_max) -> collision::Environment<float>
+    {
+        using Configuration = typename Robot::Configuration;
+
+        std::map<float, std::vector<collision::Point>> centers;
+        typename Robot::template Spheres<rake> spheres;
+
+        const auto collect = [&](std::size_t n_lanes)
+        {
+            for (auto i = 0U; i < Robot::n_spheres; ++i)
+            {
+                for (auto j = 0U; j < n_lanes; ++j)
+                {
+                    centers[spheres.r[{i, j}]].emplace_back(
+                        collision::Point{spheres.x[{i, j}], spheres.y[{i, j}], spheres.z[{i, j}]});
+                }
+            }
+        };
+
+        typename Robot::template ConfigurationBlock<rake> block;
+        if (not path.empty())
+        {
+            for (auto i = 0U; i < Robot::dimension; ++i)
+            {
+                block[i] = path.front().broadcast(i);
+            }
+
+            Robot::template sphere_fk<rake>(block, spheres);
+            collect(1);
+        }
+
+        const auto percents = FloatVector<rake>(Percents<rake>::percents);
+        for (auto k = 1U; k < path.size(); ++k)
+        {
+            const Configuration &start = path[k - 1];
+            const auto vector = path[k] - start;
+
+            // Same interpolation as validate_vector(), so the sweep covers every state a path check sees
+            for (auto i = 0U; i < Robot::dimension; ++i)
+            {
+                block[i] = start.broadcast(i) + (vector.broadcast(i) * percents);
+            }
+
+            const std::size_t n =
+                std::max(std::ceil(vector.l2_norm() / static_cast<float>(rake) * resolution), 1.F);
+            const auto backstep = vector / (rake * n);
+            for (auto s = 0U; s < n; ++s)
+            {
+                if (s != 0)
+                {
+                    for (auto i = 0U; i < Robot::dimension; ++i)
+                    {
+                        block[i] = block[i] - backstep.broadcast(i);
+                    }
+                }
+
+                Robot::template sphere_fk<rake>(block, spheres);
+                collect(rake);
+            }
+        }
+
+        collision::Environment<float> environment;
+        environment.pointclouds.reserve(centers.size());
+        for (const auto &[radius, points] : centers)
+        {
+            environment.pointclouds.emplace_back(points, r_min, r_max, radius);
+        }
+
+        environment.pointcloud_bvh = collision::PointCloudBVH(environment.pointclouds);
+
+        return environment;
+    }
+}  // namespace vamp::planning
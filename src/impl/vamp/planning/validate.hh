@@ -1,6 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <vector>
 
 #include <vamp/utils.hh>
 #include <vamp/vector.hh>
@@ -75,4 +79,156 @@ namespace vamp::planning
         auto vector = goal - start;
         return validate_vector<Robot, rake, resolution>(start, vector, vector.l2_norm(), environment);
     }
+
+    // Validates the motion from `start` through `n_extensions` consecutive increments, returning how many
+    // increments from the start are valid. Every configuration is placed relative to `start`, so neither the
+    // broadcast nor the rounding error of accumulating increments is repeated per increment. Each increment
+    // is checked at just enough evenly spaced configurations to meet the resolution. Increments that need at
+    // most half of the lanes are packed, as many as fit, into one block, and only a block that contains a
+    // collision is rechecked increment by increment to find the first invalid one. Longer increments have
+    // their lanes spread across them and walked backwards, coarse to fine, as in validate_vector().
+    template <typename Robot, std::size_t rake, std::size_t resolution>
+    inline auto validate_connect(
+        const typename Robot::Configuration &start,
+        const typename Robot::Configuration &increment,
+        float increment_length,
+        std::size_t n_extensions,
+        const collision::Environment<FloatVector<rake>> &environment) -> std::size_t
+    {
+        const std::size_t per_increment = std::max(std::ceil(increment_length * resolution), 1.F);
+        const auto step = FloatVector<rake>::fill(1.F / static_cast<float>(per_increment));
+
+        typename Robot::template ConfigurationBlock<rake> block;
+        const auto validate_block = [&environment, &block]()
+        {
+            return (environment.attachments) ? Robot::template fkcc_attach<rake>(environment, block) :
+                                               Robot::template fkcc<rake>(environment, block);
+        };
+
+        // HACK: broadcast() implicitly assumes that the rake is exactly VectorWidth
+        const auto place = [&start, &increment, &block](const FloatVector<rake> &fractions)
+        {
+            for (auto j = 0U; j < Robot::dimension; ++j)
+            {
+                block[j] = start.broadcast(j) + (increment.broadcast(j) * fractions);
+            }
+        };
+
+        const std::size_t group = rake / per_increment;
+        if (group > 1)
+        {
+            // Checks the `n` increments from `k` in one block. Lanes past the last configuration repeat it.
+            const auto validate_increments = [&](std::size_t k, std::size_t n)
+            {
+                std::array<float, rake> offsets;
+                for (auto i = 0U; i < rake; ++i)
+                {
+                    const auto lane = std::min<std::size_t>(i + 1, n * per_increment);
+                    offsets[i] = static_cast<float>(k * per_increment + lane);
+                }
+
+                place(FloatVector<rake>(offsets) * step);
+                return validate_block();
+            };
+
+            for (std::size_t k = 0; k < n_extensions; k += group)
+            {
+                const auto n = std::min(group, n_extensions - k);
+                if (validate_increments(k, n))
+                {
+                    continue;
+                }
+
+                // One of the packed increments is invalid, so if all but the last are valid, the last is not
+                for (auto i = k; i < k + n - 1; ++i)
+                {
+                    if (not validate_increments(i, 1))
+                    {
+                        return i;
+                    }
+                }
+
+                return k + n - 1;
+            }
+
+            return n_extensions;
+        }
+
+        const std::size_t stride = (per_increment + rake - 1) / rake;
+
+        std::array<float, rake> offsets;
+        for (auto i = 0U; i < rake; ++i)
+        {
+            // Lanes past the end of an increment repeat its end
+            offsets[i] = static_cast<float>(std::min((i + 1) * stride, per_increment));
+        }
+
+        for (std::size_t k = 0; k < n_extensions; ++k)
+        {
+            auto fractions = (FloatVector<rake>(offsets) + static_cast<float>(k * per_increment)) * step;
+            for (std::size_t i = 0; i < stride; ++i)
+            {
+                place(fractions);
+                if (not validate_block())
+                {
+                    return k;
+                }
+
+                fractions = fractions - step;
+            }
+        }
+
+        return n_extensions;
+    }
+
+    // Checks independent configurations rake at a time, one per lane. Only blocks that contain a collision
+    // are rechecked configuration by configuration.
+    template <typename Robot, std::size_t rake>
+    inline auto validate_configurations(
+        const std::vector<typename Robot::Configuration> &configurations,
+        const collision::Environment<FloatVector<rake>> &environment) -> std::vector<bool>
+    {
+        std::vector<bool> valid(configurations.size(), true);
+
+        typename Robot::template ConfigurationBlock<rake> block;
+        for (std::size_t base = 0; base < configurations.size(); base += rake)
+        {
+            const auto n = std::min(rake, configurations.size() - base);
+
+            std::array<typename Robot::ConfigurationArray, rake> arrays;
+            for (std::size_t i = 0; i < rake; ++i)
+            {
+                // Unused lanes repeat the last configuration of the block
+                const auto array = configurations[base + std::min(i, n - 1)].to_array();
+                std::copy_n(array.cbegin(), Robot::dimension, arrays[i].begin());
+            }
+
+            for (auto j = 0U; j < Robot::dimension; ++j)
+            {
+                std::array<float, rake> lanes;
+                for (auto i = 0U; i < rake; ++i)
+                {
+                    lanes[i] = arrays[i][j];
+                }
+
+                block[j] = FloatVector<rake>(lanes);
+            }
+
+            const bool block_valid = (environment.attachments) ?
+                                         Robot::template fkcc_attach<rake>(environment, block) :
+                                         Robot::template fkcc<rake>(environment, block);
+            if (block_valid)
+            {
+                continue;
+            }
+
+            for (auto i = 0U; i < n; ++i)
+            {
+                const auto &configuration = configurations[base + i];
+                valid[base + i] = validate_motion<Robot, rake, 1>(configuration, configuration, environment);
+            }
+        }
+
+        return valid;
+    }
 }  // namespace vamp::planning
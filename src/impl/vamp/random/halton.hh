@@ -1,7 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 #include <vamp/random/rng.hh>
+#include <vamp/robots/instance.hh>
 
 namespace vamp::rng
 {
@@ -72,6 +74,14 @@ namespace vamp::rng
             d = Configuration::fill(1);
         }
 
+        // The sequence is deterministic, so a fork continues it from the current point, as this RNG would
+        inline auto fork() noexcept -> typename RNG<Robot>::Ptr override final
+        {
+            auto forked = std::make_shared<Halton<Robot>>(*this);
+            forked->dist.rng.seed(this->fork_key());
+            return forked;
+        }
+
         inline auto next() noexcept -> Configuration override final
         {
             iterations++;
@@ -103,7 +113,7 @@ namespace vamp::rng
             n = (((b + 1.F) * y).floor() - xf).blend(Configuration::fill(1), x_eq_1);
 
             auto result = (n / d).trim();
-            Robot::scale_configuration(result);
+            robots::Instance<Robot>::current().scale_configuration(result);
             return result;
         }
     };
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <vamp/vector.hh>
 #include <vamp/random/distribution.hh>
@@ -13,6 +16,44 @@ namespace vamp::rng
         virtual inline void reset() noexcept = 0;
         virtual inline auto next() noexcept -> FloatVector<Robot::dimension> = 0;
 
+        // Independent RNG for a caller on another thread, e.g., an asynchronous query. Only this RNG's state
+        // is advanced, on the calling thread, so successive forks draw different streams.
+        virtual inline auto fork() noexcept -> Ptr = 0;
+
+        // Draws rake samples, transposed into a block with one sample per lane
+        template <std::size_t rake>
+        inline auto next_block() noexcept -> typename Robot::template ConfigurationBlock<rake>
+        {
+            std::array<typename Robot::ConfigurationArray, rake> arrays;
+            for (auto i = 0U; i < rake; ++i)
+            {
+                const auto array = next().to_array();
+                std::copy_n(array.cbegin(), Robot::dimension, arrays[i].begin());
+            }
+
+            typename Robot::template ConfigurationBlock<rake> block;
+            for (auto j = 0U; j < Robot::dimension; ++j)
+            {
+                std::array<float, rake> lanes;
+                for (auto i = 0U; i < rake; ++i)
+                {
+                    lanes[i] = arrays[i][j];
+                }
+
+                block[j] = FloatVector<rake>(lanes);
+            }
+
+            return block;
+        }
+
         Distribution dist;
+
+    protected:
+        // Key for a forked stream, drawn from this RNG's distribution
+        inline auto fork_key() noexcept -> std::uint64_t
+        {
+            const std::uint64_t high = dist.rng();
+            return (high << 32U) | dist.rng();
+        }
     };
 }  // namespace vamp::rng
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include <vamp/random/rng.hh>
+#include <vamp/random/uniform.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::rng
+{
+    // Uniform samples from an independent stream selected by a pair of keys, available on every platform.
+    // Streams with different keys can be handed to concurrent solves (e.g., one per query of a batch), so
+    // that each solve's samples do not depend on which thread runs it.
+    template <typename Robot>
+    struct Stream : public RNG<Robot>
+    {
+        using Configuration = typename Robot::Configuration;
+
+        explicit Stream(std::uint64_t key1, std::uint64_t key2) noexcept
+          : key1(key1), key2(key2), stream(key1, key2)
+        {
+            this->dist.rng.seed(key1 ^ (key2 << 32U));
+        }
+
+        inline void reset() noexcept override final
+        {
+            stream = UniformStream(key1, key2);
+            this->dist.rng.seed(key1 ^ (key2 << 32U));
+        }
+
+        inline auto fork() noexcept -> typename RNG<Robot>::Ptr override final
+        {
+            return std::make_shared<Stream<Robot>>(this->fork_key(), this->fork_key());
+        }
+
+        inline auto next() noexcept -> Configuration override final
+        {
+            constexpr auto width = FloatVector<>::num_scalars;
+
+            alignas(FloatVectorAlignment) std::array<float, Configuration::num_scalars_rounded> a = {};
+            for (auto i = 0U; i < Robot::dimension; i += width)
+            {
+                const auto lanes = stream.next().to_array();
+                const auto n = std::min<std::size_t>(width, Robot::dimension - i);
+                std::copy_n(lanes.cbegin(), n, a.begin() + i);
+            }
+
+            auto result = Configuration(a.data()).trim();
+            robots::Instance<Robot>::current().scale_configuration(result);
+            return result;
+        }
+
+    private:
+        std::uint64_t key1;
+        std::uint64_t key2;
+        UniformStream stream;
+    };
+}  // namespace vamp::rng
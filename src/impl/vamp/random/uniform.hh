@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#if defined(__x86_64__)
+extern "C"
+{
+#include <simdxorshift128plus.h>
+}
+#endif
+
+#include <vamp/vector.hh>
+
+namespace vamp::rng
+{
+    // Stream of uniform samples in [0, 1], a vector at a time. Uses the vectorized xorshift128+ on x86, and
+    // a scalar xorshift128+ per lane elsewhere.
+    class UniformStream
+    {
+    public:
+        UniformStream(std::uint64_t key1, std::uint64_t key2) noexcept
+        {
+#if defined(__x86_64__)
+            avx_xorshift128plus_init(key1, key2, &key);
+#else
+            // Seed each lane of a scalar xorshift128+ with splitmix64
+            auto splitmix = [state = key1 ^ (key2 * 0x9E3779B97F4A7C15ULL)]() mutable
+            {
+                auto z = (state += 0x9E3779B97F4A7C15ULL);
+                z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+                return z ^ (z >> 31U);
+            };
+
+            for (auto &s : state)
+            {
+                s = {splitmix(), splitmix()};
+            }
+#endif
+        }
+
+        inline auto next() noexcept -> FloatVector<>
+        {
+#if defined(__x86_64__)
+            IntVector<> bits;
+            bits.data[0] = avx_xorshift128plus(&key);
+            return FloatVector<>::map_to_range(bits, 0.F, 1.F);
+#else
+            alignas(FloatVectorAlignment) std::array<float, FloatVectorWidth> lanes;
+            for (auto i = 0U; i < FloatVectorWidth; ++i)
+            {
+                auto &[s0, s1] = state[i];
+                auto x = s0;
+                const auto y = s1;
+                s0 = y;
+                x ^= x << 23U;
+                s1 = x ^ y ^ (x >> 17U) ^ (y >> 26U);
+                lanes[i] = static_cast<float>((s1 + y) >> 40U) * 0x1.0p-24F;
+            }
+
+            return FloatVector<>(lanes);
+#endif
+        }
+
+    private:
+#if defined(__x86_64__)
+        avx_xorshift128plus_key_t key{};
+#else
+        std::array<std::array<std::uint64_t, 2>, FloatVectorWidth> state;
+#endif
+    };
+}  // namespace vamp::rng
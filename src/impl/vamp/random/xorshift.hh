@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 extern "C"
 {
 #include <simdxorshift128plus.h>
@@ -8,6 +10,7 @@ extern "C"
 #include <vamp/vector.hh>
 #include <vamp/vector/interface.hh>
 #include <vamp/random/rng.hh>
+#include <vamp/robots/instance.hh>
 
 namespace vamp::rng
 {
@@ -32,6 +35,11 @@ namespace vamp::rng
             avx_xorshift128plus_init(key1_init, key2_init, &key);
         }
 
+        inline auto fork() noexcept -> typename RNG<Robot>::Ptr override final
+        {
+            return std::make_shared<XORShift<Robot>>(this->fork_key(), this->fork_key());
+        }
+
         inline auto next() noexcept -> FloatVector<Robot::dimension> override final
         {
             for (auto i = 0U; i < IntVector::num_vectors; ++i)
@@ -40,7 +48,7 @@ namespace vamp::rng
             }
 
             auto result = FloatVector<Robot::dimension>::map_to_range(buffer, 0.F, 1.F);
-            Robot::scale_configuration(result);
+            robots::Instance<Robot>::current().scale_configuration(result);
             return result;
         }
     };
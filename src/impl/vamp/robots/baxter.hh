@@ -13,6 +13,7 @@ namespace vamp::robots
         static constexpr char *name = "baxter";
         static constexpr std::size_t dimension = 14;
         static constexpr std::size_t n_spheres = 75;
+        static constexpr std::size_t n_links = 33;
         static constexpr float min_radius = 0.012000000104308128;
         static constexpr float max_radius = 0.5;
         static constexpr std::size_t resolution = 64;
@@ -32,6 +33,44 @@ namespace vamp::robots
             "right_w0",
             "right_w1",
             "right_w2"};
+        static constexpr std::array<std::string_view, n_links> link_names = {
+            "r_gripper_r_finger_tip",
+            "r_gripper_r_finger_2",
+            "r_gripper_r_finger",
+            "r_gripper_l_finger_tip",
+            "r_gripper_l_finger_2",
+            "r_gripper_l_finger",
+            "right_gripper_base",
+            "right_hand",
+            "right_wrist",
+            "right_lower_forearm",
+            "right_upper_forearm",
+            "right_lower_elbow",
+            "right_upper_elbow",
+            "right_lower_shoulder",
+            "right_upper_shoulder",
+            "pedestal",
+            "l_gripper_r_finger_tip",
+            "l_gripper_r_finger_2",
+            "l_gripper_r_finger",
+            "l_gripper_l_finger_tip",
+            "l_gripper_l_finger_2",
+            "l_gripper_l_finger",
+            "left_gripper_base",
+            "left_hand",
+            "left_wrist",
+            "left_lower_forearm",
+            "left_upper_forearm",
+            "left_lower_elbow",
+            "left_upper_elbow",
+            "left_lower_shoulder",
+            "left_upper_shoulder",
+            "head",
+            "torso"};
+        static constexpr std::array<std::size_t, n_spheres> sphere_links = {
+            32, 32, 32, 31, 30, 30, 29, 28, 28, 28, 27, 26, 26, 26, 25, 25, 24, 24, 23, 22, 22, 21, 21, 20,
+            20, 20, 19, 19, 19, 19, 18, 18, 17, 17, 17, 16, 16, 16, 16, 15, 14, 14, 13, 12, 12, 12, 11, 10,
+            10, 10, 9, 9, 8, 8, 7, 6, 6, 5, 5, 4, 4, 4, 3, 3, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0};
         static constexpr char *end_effector = "right_gripper";
 
         using Configuration = FloatVector<dimension>;
@@ -13376,24 +13415,24 @@ namespace vamp::robots
             //
 
             // r_gripper_r_finger_tip
-            if (sphere_environment_in_collision(environment, y[428], y[429], y[430], y[431]))
+            if (sphere_environment_in_collision(environment, 0, y[428], y[429], y[430], y[431]))
             {
-                if (sphere_environment_in_collision(environment, y[284], y[285], y[286], y[287]))
+                if (sphere_environment_in_collision(environment, 0, y[284], y[285], y[286], y[287]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[288], y[289], y[290], y[291]))
+                if (sphere_environment_in_collision(environment, 0, y[288], y[289], y[290], y[291]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[292], y[293], y[294], y[295]))
+                if (sphere_environment_in_collision(environment, 0, y[292], y[293], y[294], y[295]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[296], y[297], y[298], y[299]))
+                if (sphere_environment_in_collision(environment, 0, y[296], y[297], y[298], y[299]))
                 {
                     return false;
                 }
@@ -13404,19 +13443,19 @@ namespace vamp::robots
             //
 
             // r_gripper_r_finger_2
-            if (sphere_environment_in_collision(environment, y[424], y[425], y[426], y[427]))
+            if (sphere_environment_in_collision(environment, 1, y[424], y[425], y[426], y[427]))
             {
-                if (sphere_environment_in_collision(environment, y[272], y[273], y[274], y[275]))
+                if (sphere_environment_in_collision(environment, 1, y[272], y[273], y[274], y[275]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[276], y[277], y[278], y[279]))
+                if (sphere_environment_in_collision(environment, 1, y[276], y[277], y[278], y[279]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[280], y[281], y[282], y[283]))
+                if (sphere_environment_in_collision(environment, 1, y[280], y[281], y[282], y[283]))
                 {
                     return false;
                 }
@@ -13427,14 +13466,14 @@ namespace vamp::robots
             //
 
             // r_gripper_r_finger
-            if (sphere_environment_in_collision(environment, y[420], y[421], y[422], y[423]))
+            if (sphere_environment_in_collision(environment, 2, y[420], y[421], y[422], y[423]))
             {
-                if (sphere_environment_in_collision(environment, y[264], y[265], y[266], y[267]))
+                if (sphere_environment_in_collision(environment, 2, y[264], y[265], y[266], y[267]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[268], y[269], y[270], y[271]))
+                if (sphere_environment_in_collision(environment, 2, y[268], y[269], y[270], y[271]))
                 {
                     return false;
                 }
@@ -13445,24 +13484,24 @@ namespace vamp::robots
             //
 
             // r_gripper_l_finger_tip
-            if (sphere_environment_in_collision(environment, y[416], y[417], y[418], y[419]))
+            if (sphere_environment_in_collision(environment, 3, y[416], y[417], y[418], y[419]))
             {
-                if (sphere_environment_in_collision(environment, y[248], y[249], y[250], y[251]))
+                if (sphere_environment_in_collision(environment, 3, y[248], y[249], y[250], y[251]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[252], y[253], y[254], y[255]))
+                if (sphere_environment_in_collision(environment, 3, y[252], y[253], y[254], y[255]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[256], y[257], y[258], y[259]))
+                if (sphere_environment_in_collision(environment, 3, y[256], y[257], y[258], y[259]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[260], y[261], y[262], y[263]))
+                if (sphere_environment_in_collision(environment, 3, y[260], y[261], y[262], y[263]))
                 {
                     return false;
                 }
@@ -13473,19 +13512,19 @@ namespace vamp::robots
             //
 
             // r_gripper_l_finger_2
-            if (sphere_environment_in_collision(environment, y[412], y[413], y[414], y[415]))
+            if (sphere_environment_in_collision(environment, 4, y[412], y[413], y[414], y[415]))
             {
-                if (sphere_environment_in_collision(environment, y[236], y[237], y[238], y[239]))
+                if (sphere_environment_in_collision(environment, 4, y[236], y[237], y[238], y[239]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[240], y[241], y[242], y[243]))
+                if (sphere_environment_in_collision(environment, 4, y[240], y[241], y[242], y[243]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[244], y[245], y[246], y[247]))
+                if (sphere_environment_in_collision(environment, 4, y[244], y[245], y[246], y[247]))
                 {
                     return false;
                 }
@@ -13496,14 +13535,14 @@ namespace vamp::robots
             //
 
             // r_gripper_l_finger
-            if (sphere_environment_in_collision(environment, y[408], y[409], y[410], y[411]))
+            if (sphere_environment_in_collision(environment, 5, y[408], y[409], y[410], y[411]))
             {
-                if (sphere_environment_in_collision(environment, y[228], y[229], y[230], y[231]))
+                if (sphere_environment_in_collision(environment, 5, y[228], y[229], y[230], y[231]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[232], y[233], y[234], y[235]))
+                if (sphere_environment_in_collision(environment, 5, y[232], y[233], y[234], y[235]))
                 {
                     return false;
                 }
@@ -13514,14 +13553,14 @@ namespace vamp::robots
             //
 
             // right_gripper_base
-            if (sphere_environment_in_collision(environment, y[404], y[405], y[406], y[407]))
+            if (sphere_environment_in_collision(environment, 6, y[404], y[405], y[406], y[407]))
             {
-                if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+                if (sphere_environment_in_collision(environment, 6, y[220], y[221], y[222], y[223]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+                if (sphere_environment_in_collision(environment, 6, y[224], y[225], y[226], y[227]))
                 {
                     return false;
                 }
@@ -13532,9 +13571,9 @@ namespace vamp::robots
             //
 
             // right_hand
-            if (sphere_environment_in_collision(environment, y[400], y[401], y[402], y[403]))
+            if (sphere_environment_in_collision(environment, 7, y[400], y[401], y[402], y[403]))
             {
-                if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+                if (sphere_environment_in_collision(environment, 7, y[216], y[217], y[218], y[219]))
                 {
                     return false;
                 }
@@ -13545,14 +13584,14 @@ namespace vamp::robots
             //
 
             // right_wrist
-            if (sphere_environment_in_collision(environment, y[396], y[397], y[398], y[399]))
+            if (sphere_environment_in_collision(environment, 8, y[396], y[397], y[398], y[399]))
             {
-                if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+                if (sphere_environment_in_collision(environment, 8, y[208], y[209], y[210], y[211]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+                if (sphere_environment_in_collision(environment, 8, y[212], y[213], y[214], y[215]))
                 {
                     return false;
                 }
@@ -13563,14 +13602,14 @@ namespace vamp::robots
             //
 
             // right_lower_forearm
-            if (sphere_environment_in_collision(environment, y[392], y[393], y[394], y[395]))
+            if (sphere_environment_in_collision(environment, 9, y[392], y[393], y[394], y[395]))
             {
-                if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+                if (sphere_environment_in_collision(environment, 9, y[200], y[201], y[202], y[203]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+                if (sphere_environment_in_collision(environment, 9, y[204], y[205], y[206], y[207]))
                 {
                     return false;
                 }
@@ -13581,19 +13620,19 @@ namespace vamp::robots
             //
 
             // right_upper_forearm
-            if (sphere_environment_in_collision(environment, y[388], y[389], y[390], y[391]))
+            if (sphere_environment_in_collision(environment, 10, y[388], y[389], y[390], y[391]))
             {
-                if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+                if (sphere_environment_in_collision(environment, 10, y[188], y[189], y[190], y[191]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+                if (sphere_environment_in_collision(environment, 10, y[192], y[193], y[194], y[195]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+                if (sphere_environment_in_collision(environment, 10, y[196], y[197], y[198], y[199]))
                 {
                     return false;
                 }
@@ -13604,9 +13643,9 @@ namespace vamp::robots
             //
 
             // right_lower_elbow
-            if (sphere_environment_in_collision(environment, y[384], y[385], y[386], y[387]))
+            if (sphere_environment_in_collision(environment, 11, y[384], y[385], y[386], y[387]))
             {
-                if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+                if (sphere_environment_in_collision(environment, 11, y[184], y[185], y[186], y[187]))
                 {
                     return false;
                 }
@@ -13617,19 +13656,19 @@ namespace vamp::robots
             //
 
             // right_upper_elbow
-            if (sphere_environment_in_collision(environment, y[380], y[381], y[382], y[383]))
+            if (sphere_environment_in_collision(environment, 12, y[380], y[381], y[382], y[383]))
             {
-                if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+                if (sphere_environment_in_collision(environment, 12, y[172], y[173], y[174], y[175]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+                if (sphere_environment_in_collision(environment, 12, y[176], y[177], y[178], y[179]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+                if (sphere_environment_in_collision(environment, 12, y[180], y[181], y[182], y[183]))
                 {
                     return false;
                 }
@@ -13640,9 +13679,9 @@ namespace vamp::robots
             //
 
             // right_lower_shoulder
-            if (sphere_environment_in_collision(environment, y[376], y[377], y[378], y[379]))
+            if (sphere_environment_in_collision(environment, 13, y[376], y[377], y[378], y[379]))
             {
-                if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+                if (sphere_environment_in_collision(environment, 13, y[168], y[169], y[170], y[171]))
                 {
                     return false;
                 }
@@ -13653,14 +13692,14 @@ namespace vamp::robots
             //
 
             // right_upper_shoulder
-            if (sphere_environment_in_collision(environment, y[372], y[373], y[374], y[375]))
+            if (sphere_environment_in_collision(environment, 14, y[372], y[373], y[374], y[375]))
             {
-                if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+                if (sphere_environment_in_collision(environment, 14, y[160], y[161], y[162], y[163]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+                if (sphere_environment_in_collision(environment, 14, y[164], y[165], y[166], y[167]))
                 {
                     return false;
                 }
@@ -13671,9 +13710,9 @@ namespace vamp::robots
             //
 
             // pedestal
-            if (sphere_environment_in_collision(environment, y[368], y[369], y[370], y[371]))
+            if (sphere_environment_in_collision(environment, 15, y[368], y[369], y[370], y[371]))
             {
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 15, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
@@ -13684,24 +13723,24 @@ namespace vamp::robots
             //
 
             // l_gripper_r_finger_tip
-            if (sphere_environment_in_collision(environment, y[364], y[365], y[366], y[367]))
+            if (sphere_environment_in_collision(environment, 16, y[364], y[365], y[366], y[367]))
             {
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 16, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 16, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 16, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 16, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
@@ -13712,19 +13751,19 @@ namespace vamp::robots
             //
 
             // l_gripper_r_finger_2
-            if (sphere_environment_in_collision(environment, y[360], y[361], y[362], y[363]))
+            if (sphere_environment_in_collision(environment, 17, y[360], y[361], y[362], y[363]))
             {
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 17, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 17, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 17, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
@@ -13735,14 +13774,14 @@ namespace vamp::robots
             //
 
             // l_gripper_r_finger
-            if (sphere_environment_in_collision(environment, y[356], y[357], y[358], y[359]))
+            if (sphere_environment_in_collision(environment, 18, y[356], y[357], y[358], y[359]))
             {
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 18, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 18, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
@@ -13753,24 +13792,24 @@ namespace vamp::robots
             //
 
             // l_gripper_l_finger_tip
-            if (sphere_environment_in_collision(environment, y[352], y[353], y[354], y[355]))
+            if (sphere_environment_in_collision(environment, 19, y[352], y[353], y[354], y[355]))
             {
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 19, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 19, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 19, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 19, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
@@ -13781,19 +13820,19 @@ namespace vamp::robots
             //
 
             // l_gripper_l_finger_2
-            if (sphere_environment_in_collision(environment, y[348], y[349], y[350], y[351]))
+            if (sphere_environment_in_collision(environment, 20, y[348], y[349], y[350], y[351]))
             {
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 20, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 20, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 20, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
@@ -13804,14 +13843,14 @@ namespace vamp::robots
             //
 
             // l_gripper_l_finger
-            if (sphere_environment_in_collision(environment, y[344], y[345], y[346], y[347]))
+            if (sphere_environment_in_collision(environment, 21, y[344], y[345], y[346], y[347]))
             {
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 21, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 21, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
@@ -13822,14 +13861,14 @@ namespace vamp::robots
             //
 
             // left_gripper_base
-            if (sphere_environment_in_collision(environment, y[340], y[341], y[342], y[343]))
+            if (sphere_environment_in_collision(environment, 22, y[340], y[341], y[342], y[343]))
             {
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 22, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 22, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
@@ -13840,9 +13879,9 @@ namespace vamp::robots
             //
 
             // left_hand
-            if (sphere_environment_in_collision(environment, y[336], y[337], y[338], y[339]))
+            if (sphere_environment_in_collision(environment, 23, y[336], y[337], y[338], y[339]))
             {
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 23, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
@@ -13853,14 +13892,14 @@ namespace vamp::robots
             //
 
             // left_wrist
-            if (sphere_environment_in_collision(environment, y[332], y[333], y[334], y[335]))
+            if (sphere_environment_in_collision(environment, 24, y[332], y[333], y[334], y[335]))
             {
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 24, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 24, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
@@ -13871,14 +13910,14 @@ namespace vamp::robots
             //
 
             // left_lower_forearm
-            if (sphere_environment_in_collision(environment, y[328], y[329], y[330], y[331]))
+            if (sphere_environment_in_collision(environment, 25, y[328], y[329], y[330], y[331]))
             {
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 25, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 25, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
@@ -13889,19 +13928,19 @@ namespace vamp::robots
             //
 
             // left_upper_forearm
-            if (sphere_environment_in_collision(environment, y[324], y[325], y[326], y[327]))
+            if (sphere_environment_in_collision(environment, 26, y[324], y[325], y[326], y[327]))
             {
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 26, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 26, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 26, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
@@ -13912,9 +13951,9 @@ namespace vamp::robots
             //
 
             // left_lower_elbow
-            if (sphere_environment_in_collision(environment, y[320], y[321], y[322], y[323]))
+            if (sphere_environment_in_collision(environment, 27, y[320], y[321], y[322], y[323]))
             {
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 27, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
@@ -13925,19 +13964,19 @@ namespace vamp::robots
             //
 
             // left_upper_elbow
-            if (sphere_environment_in_collision(environment, y[316], y[317], y[318], y[319]))
+            if (sphere_environment_in_collision(environment, 28, y[316], y[317], y[318], y[319]))
             {
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 28, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 28, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 28, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
@@ -13948,9 +13987,9 @@ namespace vamp::robots
             //
 
             // left_lower_shoulder
-            if (sphere_environment_in_collision(environment, y[312], y[313], y[314], y[315]))
+            if (sphere_environment_in_collision(environment, 29, y[312], y[313], y[314], y[315]))
             {
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 29, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
@@ -13961,14 +14000,14 @@ namespace vamp::robots
             //
 
             // left_upper_shoulder
-            if (sphere_environment_in_collision(environment, y[308], y[309], y[310], y[311]))
+            if (sphere_environment_in_collision(environment, 30, y[308], y[309], y[310], y[311]))
             {
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 30, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 30, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
@@ -13979,9 +14018,9 @@ namespace vamp::robots
             //
 
             // head
-            if (sphere_environment_in_collision(environment, y[304], y[305], y[306], y[307]))
+            if (sphere_environment_in_collision(environment, 31, y[304], y[305], y[306], y[307]))
             {
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 31, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
@@ -13992,19 +14031,19 @@ namespace vamp::robots
             //
 
             // torso
-            if (sphere_environment_in_collision(environment, y[300], y[301], y[302], y[303]))
+            if (sphere_environment_in_collision(environment, 32, y[300], y[301], y[302], y[303]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 32, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 32, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 32, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
@@ -27505,24 +27544,24 @@ namespace vamp::robots
             //
 
             // r_gripper_r_finger_tip
-            if (sphere_environment_in_collision(environment, y[428], y[429], y[430], y[431]))
+            if (sphere_environment_in_collision(environment, 0, y[428], y[429], y[430], y[431]))
             {
-                if (sphere_environment_in_collision(environment, y[284], y[285], y[286], y[287]))
+                if (sphere_environment_in_collision(environment, 0, y[284], y[285], y[286], y[287]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[288], y[289], y[290], y[291]))
+                if (sphere_environment_in_collision(environment, 0, y[288], y[289], y[290], y[291]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[292], y[293], y[294], y[295]))
+                if (sphere_environment_in_collision(environment, 0, y[292], y[293], y[294], y[295]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[296], y[297], y[298], y[299]))
+                if (sphere_environment_in_collision(environment, 0, y[296], y[297], y[298], y[299]))
                 {
                     return false;
                 }
@@ -27533,19 +27572,19 @@ namespace vamp::robots
             //
 
             // r_gripper_r_finger_2
-            if (sphere_environment_in_collision(environment, y[424], y[425], y[426], y[427]))
+            if (sphere_environment_in_collision(environment, 1, y[424], y[425], y[426], y[427]))
             {
-                if (sphere_environment_in_collision(environment, y[272], y[273], y[274], y[275]))
+                if (sphere_environment_in_collision(environment, 1, y[272], y[273], y[274], y[275]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[276], y[277], y[278], y[279]))
+                if (sphere_environment_in_collision(environment, 1, y[276], y[277], y[278], y[279]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[280], y[281], y[282], y[283]))
+                if (sphere_environment_in_collision(environment, 1, y[280], y[281], y[282], y[283]))
                 {
                     return false;
                 }
@@ -27556,14 +27595,14 @@ namespace vamp::robots
             //
 
             // r_gripper_r_finger
-            if (sphere_environment_in_collision(environment, y[420], y[421], y[422], y[423]))
+            if (sphere_environment_in_collision(environment, 2, y[420], y[421], y[422], y[423]))
             {
-                if (sphere_environment_in_collision(environment, y[264], y[265], y[266], y[267]))
+                if (sphere_environment_in_collision(environment, 2, y[264], y[265], y[266], y[267]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[268], y[269], y[270], y[271]))
+                if (sphere_environment_in_collision(environment, 2, y[268], y[269], y[270], y[271]))
                 {
                     return false;
                 }
@@ -27574,24 +27613,24 @@ namespace vamp::robots
             //
 
             // r_gripper_l_finger_tip
-            if (sphere_environment_in_collision(environment, y[416], y[417], y[418], y[419]))
+            if (sphere_environment_in_collision(environment, 3, y[416], y[417], y[418], y[419]))
             {
-                if (sphere_environment_in_collision(environment, y[248], y[249], y[250], y[251]))
+                if (sphere_environment_in_collision(environment, 3, y[248], y[249], y[250], y[251]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[252], y[253], y[254], y[255]))
+                if (sphere_environment_in_collision(environment, 3, y[252], y[253], y[254], y[255]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[256], y[257], y[258], y[259]))
+                if (sphere_environment_in_collision(environment, 3, y[256], y[257], y[258], y[259]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[260], y[261], y[262], y[263]))
+                if (sphere_environment_in_collision(environment, 3, y[260], y[261], y[262], y[263]))
                 {
                     return false;
                 }
@@ -27602,19 +27641,19 @@ namespace vamp::robots
             //
 
             // r_gripper_l_finger_2
-            if (sphere_environment_in_collision(environment, y[412], y[413], y[414], y[415]))
+            if (sphere_environment_in_collision(environment, 4, y[412], y[413], y[414], y[415]))
             {
-                if (sphere_environment_in_collision(environment, y[236], y[237], y[238], y[239]))
+                if (sphere_environment_in_collision(environment, 4, y[236], y[237], y[238], y[239]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[240], y[241], y[242], y[243]))
+                if (sphere_environment_in_collision(environment, 4, y[240], y[241], y[242], y[243]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[244], y[245], y[246], y[247]))
+                if (sphere_environment_in_collision(environment, 4, y[244], y[245], y[246], y[247]))
                 {
                     return false;
                 }
@@ -27625,14 +27664,14 @@ namespace vamp::robots
             //
 
             // r_gripper_l_finger
-            if (sphere_environment_in_collision(environment, y[408], y[409], y[410], y[411]))
+            if (sphere_environment_in_collision(environment, 5, y[408], y[409], y[410], y[411]))
             {
-                if (sphere_environment_in_collision(environment, y[228], y[229], y[230], y[231]))
+                if (sphere_environment_in_collision(environment, 5, y[228], y[229], y[230], y[231]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[232], y[233], y[234], y[235]))
+                if (sphere_environment_in_collision(environment, 5, y[232], y[233], y[234], y[235]))
                 {
                     return false;
                 }
@@ -27643,14 +27682,14 @@ namespace vamp::robots
             //
 
             // right_gripper_base
-            if (sphere_environment_in_collision(environment, y[404], y[405], y[406], y[407]))
+            if (sphere_environment_in_collision(environment, 6, y[404], y[405], y[406], y[407]))
             {
-                if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+                if (sphere_environment_in_collision(environment, 6, y[220], y[221], y[222], y[223]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+                if (sphere_environment_in_collision(environment, 6, y[224], y[225], y[226], y[227]))
                 {
                     return false;
                 }
@@ -27661,9 +27700,9 @@ namespace vamp::robots
             //
 
             // right_hand
-            if (sphere_environment_in_collision(environment, y[400], y[401], y[402], y[403]))
+            if (sphere_environment_in_collision(environment, 7, y[400], y[401], y[402], y[403]))
             {
-                if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+                if (sphere_environment_in_collision(environment, 7, y[216], y[217], y[218], y[219]))
                 {
                     return false;
                 }
@@ -27674,14 +27713,14 @@ namespace vamp::robots
             //
 
             // right_wrist
-            if (sphere_environment_in_collision(environment, y[396], y[397], y[398], y[399]))
+            if (sphere_environment_in_collision(environment, 8, y[396], y[397], y[398], y[399]))
             {
-                if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+                if (sphere_environment_in_collision(environment, 8, y[208], y[209], y[210], y[211]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+                if (sphere_environment_in_collision(environment, 8, y[212], y[213], y[214], y[215]))
                 {
                     return false;
                 }
@@ -27692,14 +27731,14 @@ namespace vamp::robots
             //
 
             // right_lower_forearm
-            if (sphere_environment_in_collision(environment, y[392], y[393], y[394], y[395]))
+            if (sphere_environment_in_collision(environment, 9, y[392], y[393], y[394], y[395]))
             {
-                if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+                if (sphere_environment_in_collision(environment, 9, y[200], y[201], y[202], y[203]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+                if (sphere_environment_in_collision(environment, 9, y[204], y[205], y[206], y[207]))
                 {
                     return false;
                 }
@@ -27710,19 +27749,19 @@ namespace vamp::robots
             //
 
             // right_upper_forearm
-            if (sphere_environment_in_collision(environment, y[388], y[389], y[390], y[391]))
+            if (sphere_environment_in_collision(environment, 10, y[388], y[389], y[390], y[391]))
             {
-                if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+                if (sphere_environment_in_collision(environment, 10, y[188], y[189], y[190], y[191]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+                if (sphere_environment_in_collision(environment, 10, y[192], y[193], y[194], y[195]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+                if (sphere_environment_in_collision(environment, 10, y[196], y[197], y[198], y[199]))
                 {
                     return false;
                 }
@@ -27733,9 +27772,9 @@ namespace vamp::robots
             //
 
             // right_lower_elbow
-            if (sphere_environment_in_collision(environment, y[384], y[385], y[386], y[387]))
+            if (sphere_environment_in_collision(environment, 11, y[384], y[385], y[386], y[387]))
             {
-                if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+                if (sphere_environment_in_collision(environment, 11, y[184], y[185], y[186], y[187]))
                 {
                     return false;
                 }
@@ -27746,19 +27785,19 @@ namespace vamp::robots
             //
 
             // right_upper_elbow
-            if (sphere_environment_in_collision(environment, y[380], y[381], y[382], y[383]))
+            if (sphere_environment_in_collision(environment, 12, y[380], y[381], y[382], y[383]))
             {
-                if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+                if (sphere_environment_in_collision(environment, 12, y[172], y[173], y[174], y[175]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+                if (sphere_environment_in_collision(environment, 12, y[176], y[177], y[178], y[179]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+                if (sphere_environment_in_collision(environment, 12, y[180], y[181], y[182], y[183]))
                 {
                     return false;
                 }
@@ -27769,9 +27808,9 @@ namespace vamp::robots
             //
 
             // right_lower_shoulder
-            if (sphere_environment_in_collision(environment, y[376], y[377], y[378], y[379]))
+            if (sphere_environment_in_collision(environment, 13, y[376], y[377], y[378], y[379]))
             {
-                if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+                if (sphere_environment_in_collision(environment, 13, y[168], y[169], y[170], y[171]))
                 {
                     return false;
                 }
@@ -27782,14 +27821,14 @@ namespace vamp::robots
             //
 
             // right_upper_shoulder
-            if (sphere_environment_in_collision(environment, y[372], y[373], y[374], y[375]))
+            if (sphere_environment_in_collision(environment, 14, y[372], y[373], y[374], y[375]))
             {
-                if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+                if (sphere_environment_in_collision(environment, 14, y[160], y[161], y[162], y[163]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+                if (sphere_environment_in_collision(environment, 14, y[164], y[165], y[166], y[167]))
                 {
                     return false;
                 }
@@ -27800,9 +27839,9 @@ namespace vamp::robots
             //
 
             // pedestal
-            if (sphere_environment_in_collision(environment, y[368], y[369], y[370], y[371]))
+            if (sphere_environment_in_collision(environment, 15, y[368], y[369], y[370], y[371]))
             {
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 15, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
@@ -27813,24 +27852,24 @@ namespace vamp::robots
             //
 
             // l_gripper_r_finger_tip
-            if (sphere_environment_in_collision(environment, y[364], y[365], y[366], y[367]))
+            if (sphere_environment_in_collision(environment, 16, y[364], y[365], y[366], y[367]))
             {
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 16, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 16, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 16, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 16, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
@@ -27841,19 +27880,19 @@ namespace vamp::robots
             //
 
             // l_gripper_r_finger_2
-            if (sphere_environment_in_collision(environment, y[360], y[361], y[362], y[363]))
+            if (sphere_environment_in_collision(environment, 17, y[360], y[361], y[362], y[363]))
             {
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 17, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 17, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 17, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
@@ -27864,14 +27903,14 @@ namespace vamp::robots
             //
 
             // l_gripper_r_finger
-            if (sphere_environment_in_collision(environment, y[356], y[357], y[358], y[359]))
+            if (sphere_environment_in_collision(environment, 18, y[356], y[357], y[358], y[359]))
             {
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 18, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 18, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
@@ -27882,24 +27921,24 @@ namespace vamp::robots
             //
 
             // l_gripper_l_finger_tip
-            if (sphere_environment_in_collision(environment, y[352], y[353], y[354], y[355]))
+            if (sphere_environment_in_collision(environment, 19, y[352], y[353], y[354], y[355]))
             {
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 19, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 19, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 19, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 19, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
@@ -27910,19 +27949,19 @@ namespace vamp::robots
             //
 
             // l_gripper_l_finger_2
-            if (sphere_environment_in_collision(environment, y[348], y[349], y[350], y[351]))
+            if (sphere_environment_in_collision(environment, 20, y[348], y[349], y[350], y[351]))
             {
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 20, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 20, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 20, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
@@ -27933,14 +27972,14 @@ namespace vamp::robots
             //
 
             // l_gripper_l_finger
-            if (sphere_environment_in_collision(environment, y[344], y[345], y[346], y[347]))
+            if (sphere_environment_in_collision(environment, 21, y[344], y[345], y[346], y[347]))
             {
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 21, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 21, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
@@ -27951,14 +27990,14 @@ namespace vamp::robots
             //
 
             // left_gripper_base
-            if (sphere_environment_in_collision(environment, y[340], y[341], y[342], y[343]))
+            if (sphere_environment_in_collision(environment, 22, y[340], y[341], y[342], y[343]))
             {
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 22, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 22, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
@@ -27969,9 +28008,9 @@ namespace vamp::robots
             //
 
             // left_hand
-            if (sphere_environment_in_collision(environment, y[336], y[337], y[338], y[339]))
+            if (sphere_environment_in_collision(environment, 23, y[336], y[337], y[338], y[339]))
             {
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 23, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
@@ -27982,14 +28021,14 @@ namespace vamp::robots
             //
 
             // left_wrist
-            if (sphere_environment_in_collision(environment, y[332], y[333], y[334], y[335]))
+            if (sphere_environment_in_collision(environment, 24, y[332], y[333], y[334], y[335]))
             {
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 24, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 24, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
@@ -28000,14 +28039,14 @@ namespace vamp::robots
             //
 
             // left_lower_forearm
-            if (sphere_environment_in_collision(environment, y[328], y[329], y[330], y[331]))
+            if (sphere_environment_in_collision(environment, 25, y[328], y[329], y[330], y[331]))
             {
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 25, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 25, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
@@ -28018,19 +28057,19 @@ namespace vamp::robots
             //
 
             // left_upper_forearm
-            if (sphere_environment_in_collision(environment, y[324], y[325], y[326], y[327]))
+            if (sphere_environment_in_collision(environment, 26, y[324], y[325], y[326], y[327]))
             {
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 26, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 26, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 26, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
@@ -28041,9 +28080,9 @@ namespace vamp::robots
             //
 
             // left_lower_elbow
-            if (sphere_environment_in_collision(environment, y[320], y[321], y[322], y[323]))
+            if (sphere_environment_in_collision(environment, 27, y[320], y[321], y[322], y[323]))
             {
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 27, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
@@ -28054,19 +28093,19 @@ namespace vamp::robots
             //
 
             // left_upper_elbow
-            if (sphere_environment_in_collision(environment, y[316], y[317], y[318], y[319]))
+            if (sphere_environment_in_collision(environment, 28, y[316], y[317], y[318], y[319]))
             {
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 28, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 28, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 28, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
@@ -28077,9 +28116,9 @@ namespace vamp::robots
             //
 
             // left_lower_shoulder
-            if (sphere_environment_in_collision(environment, y[312], y[313], y[314], y[315]))
+            if (sphere_environment_in_collision(environment, 29, y[312], y[313], y[314], y[315]))
             {
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 29, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
@@ -28090,14 +28129,14 @@ namespace vamp::robots
             //
 
             // left_upper_shoulder
-            if (sphere_environment_in_collision(environment, y[308], y[309], y[310], y[311]))
+            if (sphere_environment_in_collision(environment, 30, y[308], y[309], y[310], y[311]))
             {
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 30, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 30, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
@@ -28108,9 +28147,9 @@ namespace vamp::robots
             //
 
             // head
-            if (sphere_environment_in_collision(environment, y[304], y[305], y[306], y[307]))
+            if (sphere_environment_in_collision(environment, 31, y[304], y[305], y[306], y[307]))
             {
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 31, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
@@ -28121,19 +28160,19 @@ namespace vamp::robots
             //
 
             // torso
-            if (sphere_environment_in_collision(environment, y[300], y[301], y[302], y[303]))
+            if (sphere_environment_in_collision(environment, 32, y[300], y[301], y[302], y[303]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 32, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 32, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 32, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
@@ -41334,8 +41373,23 @@ namespace vamp::robots
 
         inline static auto eefk(const std::array<float, 14> &x) noexcept -> Eigen::Isometry3f
         {
-            std::array<float, 42> v;
-            std::array<float, 12> y;
+            return to_isometry(eefk_transform<float>(x).data());
+        }
+
+        // End-effector poses of a block of configurations, one per lane, as the translation followed by the
+        // column-major rotation
+        template <std::size_t rake>
+        inline static auto
+        eefk(const ConfigurationBlock<rake> &x) noexcept -> std::array<FloatVector<rake>, 12>
+        {
+            return eefk_transform<FloatVector<rake>>(x);
+        }
+
+        template <typename DataT, typename InputT>
+        inline static auto eefk_transform(const InputT &x) noexcept -> std::array<DataT, 12>
+        {
+            std::array<DataT, 42> v;
+            std::array<DataT, 12> y;
 
             v[0] = cos(x[7]);
             v[1] = sin(x[7]);
@@ -41446,7 +41500,7 @@ namespace vamp::robots
             y[7] = v[32] * v[11] + v[17] * v[30] + v[13] * v[27];
             y[8] = v[38] * v[11] + v[34] * v[30] + v[3] * v[27];
 
-            return to_isometry(y.data());
+            return y;
         }
     };
 }  // namespace vamp::robots
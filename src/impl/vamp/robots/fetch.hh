@@ -13,6 +13,7 @@ namespace vamp::robots
         static constexpr char *name = "fetch";
         static constexpr std::size_t dimension = 8;
         static constexpr std::size_t n_spheres = 111;
+        static constexpr std::size_t n_links = 15;
         static constexpr float min_radius = 0.012000000104308128;
         static constexpr float max_radius = 0.23999999463558197;
         static constexpr std::size_t resolution = 32;
@@ -26,6 +27,28 @@ namespace vamp::robots
             "forearm_roll_joint",
             "wrist_flex_joint",
             "wrist_roll_joint"};
+        static constexpr std::array<std::string_view, n_links> link_names = {
+            "torso_lift_link_collision_2",
+            "r_gripper_finger_link",
+            "l_gripper_finger_link",
+            "gripper_link",
+            "wrist_roll_link",
+            "wrist_flex_link",
+            "forearm_roll_link",
+            "elbow_flex_link",
+            "upperarm_roll_link",
+            "shoulder_lift_link",
+            "shoulder_pan_link",
+            "head_pan_link",
+            "torso_lift_link",
+            "torso_fixed_link",
+            "base_link"};
+        static constexpr std::array<std::size_t, n_spheres> sphere_links = {
+            14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 13, 13, 13, 13, 13, 13, 12, 12, 12, 12,
+            12, 12, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            11, 11, 11, 11, 11, 11, 10, 10, 10, 10, 9, 9, 9, 9, 9, 9, 9, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7,
+            7, 7, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1,
+            1, 0};
         static constexpr char *end_effector = "gripper_link";
 
         using Configuration = FloatVector<dimension>;
@@ -17779,9 +17802,9 @@ namespace vamp::robots
             //
 
             // torso_lift_link_collision_2
-            if (sphere_environment_in_collision(environment, y[500], y[501], y[502], y[503]))
+            if (sphere_environment_in_collision(environment, 0, y[500], y[501], y[502], y[503]))
             {
-                if (sphere_environment_in_collision(environment, y[440], y[441], y[442], y[443]))
+                if (sphere_environment_in_collision(environment, 0, y[440], y[441], y[442], y[443]))
                 {
                     return false;
                 }
@@ -17792,34 +17815,34 @@ namespace vamp::robots
             //
 
             // r_gripper_finger_link
-            if (sphere_environment_in_collision(environment, y[496], y[497], y[498], y[499]))
+            if (sphere_environment_in_collision(environment, 1, y[496], y[497], y[498], y[499]))
             {
-                if (sphere_environment_in_collision(environment, y[416], y[417], y[418], y[419]))
+                if (sphere_environment_in_collision(environment, 1, y[416], y[417], y[418], y[419]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[420], y[421], y[422], y[423]))
+                if (sphere_environment_in_collision(environment, 1, y[420], y[421], y[422], y[423]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[424], y[425], y[426], y[427]))
+                if (sphere_environment_in_collision(environment, 1, y[424], y[425], y[426], y[427]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[428], y[429], y[430], y[431]))
+                if (sphere_environment_in_collision(environment, 1, y[428], y[429], y[430], y[431]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[432], y[433], y[434], y[435]))
+                if (sphere_environment_in_collision(environment, 1, y[432], y[433], y[434], y[435]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[436], y[437], y[438], y[439]))
+                if (sphere_environment_in_collision(environment, 1, y[436], y[437], y[438], y[439]))
                 {
                     return false;
                 }
@@ -17830,34 +17853,34 @@ namespace vamp::robots
             //
 
             // l_gripper_finger_link
-            if (sphere_environment_in_collision(environment, y[492], y[493], y[494], y[495]))
+            if (sphere_environment_in_collision(environment, 2, y[492], y[493], y[494], y[495]))
             {
-                if (sphere_environment_in_collision(environment, y[392], y[393], y[394], y[395]))
+                if (sphere_environment_in_collision(environment, 2, y[392], y[393], y[394], y[395]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[396], y[397], y[398], y[399]))
+                if (sphere_environment_in_collision(environment, 2, y[396], y[397], y[398], y[399]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[400], y[401], y[402], y[403]))
+                if (sphere_environment_in_collision(environment, 2, y[400], y[401], y[402], y[403]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[404], y[405], y[406], y[407]))
+                if (sphere_environment_in_collision(environment, 2, y[404], y[405], y[406], y[407]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[408], y[409], y[410], y[411]))
+                if (sphere_environment_in_collision(environment, 2, y[408], y[409], y[410], y[411]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[412], y[413], y[414], y[415]))
+                if (sphere_environment_in_collision(environment, 2, y[412], y[413], y[414], y[415]))
                 {
                     return false;
                 }
@@ -17868,24 +17891,24 @@ namespace vamp::robots
             //
 
             // gripper_link
-            if (sphere_environment_in_collision(environment, y[488], y[489], y[490], y[491]))
+            if (sphere_environment_in_collision(environment, 3, y[488], y[489], y[490], y[491]))
             {
-                if (sphere_environment_in_collision(environment, y[376], y[377], y[378], y[379]))
+                if (sphere_environment_in_collision(environment, 3, y[376], y[377], y[378], y[379]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[380], y[381], y[382], y[383]))
+                if (sphere_environment_in_collision(environment, 3, y[380], y[381], y[382], y[383]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[384], y[385], y[386], y[387]))
+                if (sphere_environment_in_collision(environment, 3, y[384], y[385], y[386], y[387]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[388], y[389], y[390], y[391]))
+                if (sphere_environment_in_collision(environment, 3, y[388], y[389], y[390], y[391]))
                 {
                     return false;
                 }
@@ -17896,14 +17919,14 @@ namespace vamp::robots
             //
 
             // wrist_roll_link
-            if (sphere_environment_in_collision(environment, y[484], y[485], y[486], y[487]))
+            if (sphere_environment_in_collision(environment, 4, y[484], y[485], y[486], y[487]))
             {
-                if (sphere_environment_in_collision(environment, y[368], y[369], y[370], y[371]))
+                if (sphere_environment_in_collision(environment, 4, y[368], y[369], y[370], y[371]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[372], y[373], y[374], y[375]))
+                if (sphere_environment_in_collision(environment, 4, y[372], y[373], y[374], y[375]))
                 {
                     return false;
                 }
@@ -17914,34 +17937,34 @@ namespace vamp::robots
             //
 
             // wrist_flex_link
-            if (sphere_environment_in_collision(environment, y[480], y[481], y[482], y[483]))
+            if (sphere_environment_in_collision(environment, 5, y[480], y[481], y[482], y[483]))
             {
-                if (sphere_environment_in_collision(environment, y[344], y[345], y[346], y[347]))
+                if (sphere_environment_in_collision(environment, 5, y[344], y[345], y[346], y[347]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[348], y[349], y[350], y[351]))
+                if (sphere_environment_in_collision(environment, 5, y[348], y[349], y[350], y[351]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[352], y[353], y[354], y[355]))
+                if (sphere_environment_in_collision(environment, 5, y[352], y[353], y[354], y[355]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[356], y[357], y[358], y[359]))
+                if (sphere_environment_in_collision(environment, 5, y[356], y[357], y[358], y[359]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[360], y[361], y[362], y[363]))
+                if (sphere_environment_in_collision(environment, 5, y[360], y[361], y[362], y[363]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[364], y[365], y[366], y[367]))
+                if (sphere_environment_in_collision(environment, 5, y[364], y[365], y[366], y[367]))
                 {
                     return false;
                 }
@@ -17952,39 +17975,39 @@ namespace vamp::robots
             //
 
             // forearm_roll_link
-            if (sphere_environment_in_collision(environment, y[476], y[477], y[478], y[479]))
+            if (sphere_environment_in_collision(environment, 6, y[476], y[477], y[478], y[479]))
             {
-                if (sphere_environment_in_collision(environment, y[316], y[317], y[318], y[319]))
+                if (sphere_environment_in_collision(environment, 6, y[316], y[317], y[318], y[319]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[320], y[321], y[322], y[323]))
+                if (sphere_environment_in_collision(environment, 6, y[320], y[321], y[322], y[323]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[324], y[325], y[326], y[327]))
+                if (sphere_environment_in_collision(environment, 6, y[324], y[325], y[326], y[327]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[328], y[329], y[330], y[331]))
+                if (sphere_environment_in_collision(environment, 6, y[328], y[329], y[330], y[331]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[332], y[333], y[334], y[335]))
+                if (sphere_environment_in_collision(environment, 6, y[332], y[333], y[334], y[335]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[336], y[337], y[338], y[339]))
+                if (sphere_environment_in_collision(environment, 6, y[336], y[337], y[338], y[339]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[340], y[341], y[342], y[343]))
+                if (sphere_environment_in_collision(environment, 6, y[340], y[341], y[342], y[343]))
                 {
                     return false;
                 }
@@ -17995,34 +18018,34 @@ namespace vamp::robots
             //
 
             // elbow_flex_link
-            if (sphere_environment_in_collision(environment, y[472], y[473], y[474], y[475]))
+            if (sphere_environment_in_collision(environment, 7, y[472], y[473], y[474], y[475]))
             {
-                if (sphere_environment_in_collision(environment, y[292], y[293], y[294], y[295]))
+                if (sphere_environment_in_collision(environment, 7, y[292], y[293], y[294], y[295]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[296], y[297], y[298], y[299]))
+                if (sphere_environment_in_collision(environment, 7, y[296], y[297], y[298], y[299]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[300], y[301], y[302], y[303]))
+                if (sphere_environment_in_collision(environment, 7, y[300], y[301], y[302], y[303]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[304], y[305], y[306], y[307]))
+                if (sphere_environment_in_collision(environment, 7, y[304], y[305], y[306], y[307]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[308], y[309], y[310], y[311]))
+                if (sphere_environment_in_collision(environment, 7, y[308], y[309], y[310], y[311]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[312], y[313], y[314], y[315]))
+                if (sphere_environment_in_collision(environment, 7, y[312], y[313], y[314], y[315]))
                 {
                     return false;
                 }
@@ -18033,44 +18056,44 @@ namespace vamp::robots
             //
 
             // upperarm_roll_link
-            if (sphere_environment_in_collision(environment, y[468], y[469], y[470], y[471]))
+            if (sphere_environment_in_collision(environment, 8, y[468], y[469], y[470], y[471]))
             {
-                if (sphere_environment_in_collision(environment, y[260], y[261], y[262], y[263]))
+                if (sphere_environment_in_collision(environment, 8, y[260], y[261], y[262], y[263]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[264], y[265], y[266], y[267]))
+                if (sphere_environment_in_collision(environment, 8, y[264], y[265], y[266], y[267]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[268], y[269], y[270], y[271]))
+                if (sphere_environment_in_collision(environment, 8, y[268], y[269], y[270], y[271]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[272], y[273], y[274], y[275]))
+                if (sphere_environment_in_collision(environment, 8, y[272], y[273], y[274], y[275]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[276], y[277], y[278], y[279]))
+                if (sphere_environment_in_collision(environment, 8, y[276], y[277], y[278], y[279]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[280], y[281], y[282], y[283]))
+                if (sphere_environment_in_collision(environment, 8, y[280], y[281], y[282], y[283]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[284], y[285], y[286], y[287]))
+                if (sphere_environment_in_collision(environment, 8, y[284], y[285], y[286], y[287]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[288], y[289], y[290], y[291]))
+                if (sphere_environment_in_collision(environment, 8, y[288], y[289], y[290], y[291]))
                 {
                     return false;
                 }
@@ -18081,39 +18104,39 @@ namespace vamp::robots
             //
 
             // shoulder_lift_link
-            if (sphere_environment_in_collision(environment, y[464], y[465], y[466], y[467]))
+            if (sphere_environment_in_collision(environment, 9, y[464], y[465], y[466], y[467]))
             {
-                if (sphere_environment_in_collision(environment, y[232], y[233], y[234], y[235]))
+                if (sphere_environment_in_collision(environment, 9, y[232], y[233], y[234], y[235]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[236], y[237], y[238], y[239]))
+                if (sphere_environment_in_collision(environment, 9, y[236], y[237], y[238], y[239]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[240], y[241], y[242], y[243]))
+                if (sphere_environment_in_collision(environment, 9, y[240], y[241], y[242], y[243]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[244], y[245], y[246], y[247]))
+                if (sphere_environment_in_collision(environment, 9, y[244], y[245], y[246], y[247]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[248], y[249], y[250], y[251]))
+                if (sphere_environment_in_collision(environment, 9, y[248], y[249], y[250], y[251]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[252], y[253], y[254], y[255]))
+                if (sphere_environment_in_collision(environment, 9, y[252], y[253], y[254], y[255]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[256], y[257], y[258], y[259]))
+                if (sphere_environment_in_collision(environment, 9, y[256], y[257], y[258], y[259]))
                 {
                     return false;
                 }
@@ -18124,24 +18147,24 @@ namespace vamp::robots
             //
 
             // shoulder_pan_link
-            if (sphere_environment_in_collision(environment, y[460], y[461], y[462], y[463]))
+            if (sphere_environment_in_collision(environment, 10, y[460], y[461], y[462], y[463]))
             {
-                if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+                if (sphere_environment_in_collision(environment, 10, y[216], y[217], y[218], y[219]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+                if (sphere_environment_in_collision(environment, 10, y[220], y[221], y[222], y[223]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+                if (sphere_environment_in_collision(environment, 10, y[224], y[225], y[226], y[227]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[228], y[229], y[230], y[231]))
+                if (sphere_environment_in_collision(environment, 10, y[228], y[229], y[230], y[231]))
                 {
                     return false;
                 }
@@ -18152,144 +18175,144 @@ namespace vamp::robots
             //
 
             // head_pan_link
-            if (sphere_environment_in_collision(environment, y[456], y[457], y[458], y[459]))
+            if (sphere_environment_in_collision(environment, 11, y[456], y[457], y[458], y[459]))
             {
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 11, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 11, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 11, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 11, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 11, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 11, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 11, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 11, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 11, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 11, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 11, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 11, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 11, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 11, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+                if (sphere_environment_in_collision(environment, 11, y[160], y[161], y[162], y[163]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+                if (sphere_environment_in_collision(environment, 11, y[164], y[165], y[166], y[167]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+                if (sphere_environment_in_collision(environment, 11, y[168], y[169], y[170], y[171]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+                if (sphere_environment_in_collision(environment, 11, y[172], y[173], y[174], y[175]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+                if (sphere_environment_in_collision(environment, 11, y[176], y[177], y[178], y[179]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+                if (sphere_environment_in_collision(environment, 11, y[180], y[181], y[182], y[183]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+                if (sphere_environment_in_collision(environment, 11, y[184], y[185], y[186], y[187]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+                if (sphere_environment_in_collision(environment, 11, y[188], y[189], y[190], y[191]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+                if (sphere_environment_in_collision(environment, 11, y[192], y[193], y[194], y[195]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+                if (sphere_environment_in_collision(environment, 11, y[196], y[197], y[198], y[199]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+                if (sphere_environment_in_collision(environment, 11, y[200], y[201], y[202], y[203]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+                if (sphere_environment_in_collision(environment, 11, y[204], y[205], y[206], y[207]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+                if (sphere_environment_in_collision(environment, 11, y[208], y[209], y[210], y[211]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+                if (sphere_environment_in_collision(environment, 11, y[212], y[213], y[214], y[215]))
                 {
                     return false;
                 }
@@ -18300,34 +18323,34 @@ namespace vamp::robots
             //
 
             // torso_lift_link
-            if (sphere_environment_in_collision(environment, y[452], y[453], y[454], y[455]))
+            if (sphere_environment_in_collision(environment, 12, y[452], y[453], y[454], y[455]))
             {
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 12, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 12, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 12, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 12, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 12, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 12, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
@@ -18338,34 +18361,34 @@ namespace vamp::robots
             //
 
             // torso_fixed_link
-            if (sphere_environment_in_collision(environment, y[448], y[449], y[450], y[451]))
+            if (sphere_environment_in_collision(environment, 13, y[448], y[449], y[450], y[451]))
             {
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 13, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 13, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 13, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 13, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 13, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 13, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
@@ -18376,74 +18399,74 @@ namespace vamp::robots
             //
 
             // base_link
-            if (sphere_environment_in_collision(environment, y[444], y[445], y[446], y[447]))
+            if (sphere_environment_in_collision(environment, 14, y[444], y[445], y[446], y[447]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 14, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 14, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 14, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 14, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 14, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 14, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 14, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 14, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 14, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 14, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 14, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 14, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 14, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 14, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
@@ -34813,9 +34836,9 @@ namespace vamp::robots
             //
 
             // torso_lift_link_collision_2
-            if (sphere_environment_in_collision(environment, y[500], y[501], y[502], y[503]))
+            if (sphere_environment_in_collision(environment, 0, y[500], y[501], y[502], y[503]))
             {
-                if (sphere_environment_in_collision(environment, y[440], y[441], y[442], y[443]))
+                if (sphere_environment_in_collision(environment, 0, y[440], y[441], y[442], y[443]))
                 {
                     return false;
                 }
@@ -34826,34 +34849,34 @@ namespace vamp::robots
             //
 
             // r_gripper_finger_link
-            if (sphere_environment_in_collision(environment, y[496], y[497], y[498], y[499]))
+            if (sphere_environment_in_collision(environment, 1, y[496], y[497], y[498], y[499]))
             {
-                if (sphere_environment_in_collision(environment, y[416], y[417], y[418], y[419]))
+                if (sphere_environment_in_collision(environment, 1, y[416], y[417], y[418], y[419]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[420], y[421], y[422], y[423]))
+                if (sphere_environment_in_collision(environment, 1, y[420], y[421], y[422], y[423]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[424], y[425], y[426], y[427]))
+                if (sphere_environment_in_collision(environment, 1, y[424], y[425], y[426], y[427]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[428], y[429], y[430], y[431]))
+                if (sphere_environment_in_collision(environment, 1, y[428], y[429], y[430], y[431]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[432], y[433], y[434], y[435]))
+                if (sphere_environment_in_collision(environment, 1, y[432], y[433], y[434], y[435]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[436], y[437], y[438], y[439]))
+                if (sphere_environment_in_collision(environment, 1, y[436], y[437], y[438], y[439]))
                 {
                     return false;
                 }
@@ -34864,34 +34887,34 @@ namespace vamp::robots
             //
 
             // l_gripper_finger_link
-            if (sphere_environment_in_collision(environment, y[492], y[493], y[494], y[495]))
+            if (sphere_environment_in_collision(environment, 2, y[492], y[493], y[494], y[495]))
             {
-                if (sphere_environment_in_collision(environment, y[392], y[393], y[394], y[395]))
+                if (sphere_environment_in_collision(environment, 2, y[392], y[393], y[394], y[395]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[396], y[397], y[398], y[399]))
+                if (sphere_environment_in_collision(environment, 2, y[396], y[397], y[398], y[399]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[400], y[401], y[402], y[403]))
+                if (sphere_environment_in_collision(environment, 2, y[400], y[401], y[402], y[403]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[404], y[405], y[406], y[407]))
+                if (sphere_environment_in_collision(environment, 2, y[404], y[405], y[406], y[407]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[408], y[409], y[410], y[411]))
+                if (sphere_environment_in_collision(environment, 2, y[408], y[409], y[410], y[411]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[412], y[413], y[414], y[415]))
+                if (sphere_environment_in_collision(environment, 2, y[412], y[413], y[414], y[415]))
                 {
                     return false;
                 }
@@ -34902,24 +34925,24 @@ namespace vamp::robots
             //
 
             // gripper_link
-            if (sphere_environment_in_collision(environment, y[488], y[489], y[490], y[491]))
+            if (sphere_environment_in_collision(environment, 3, y[488], y[489], y[490], y[491]))
             {
-                if (sphere_environment_in_collision(environment, y[376], y[377], y[378], y[379]))
+                if (sphere_environment_in_collision(environment, 3, y[376], y[377], y[378], y[379]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[380], y[381], y[382], y[383]))
+                if (sphere_environment_in_collision(environment, 3, y[380], y[381], y[382], y[383]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[384], y[385], y[386], y[387]))
+                if (sphere_environment_in_collision(environment, 3, y[384], y[385], y[386], y[387]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[388], y[389], y[390], y[391]))
+                if (sphere_environment_in_collision(environment, 3, y[388], y[389], y[390], y[391]))
                 {
                     return false;
                 }
@@ -34930,14 +34953,14 @@ namespace vamp::robots
             //
 
             // wrist_roll_link
-            if (sphere_environment_in_collision(environment, y[484], y[485], y[486], y[487]))
+            if (sphere_environment_in_collision(environment, 4, y[484], y[485], y[486], y[487]))
             {
-                if (sphere_environment_in_collision(environment, y[368], y[369], y[370], y[371]))
+                if (sphere_environment_in_collision(environment, 4, y[368], y[369], y[370], y[371]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[372], y[373], y[374], y[375]))
+                if (sphere_environment_in_collision(environment, 4, y[372], y[373], y[374], y[375]))
                 {
                     return false;
                 }
@@ -34948,34 +34971,34 @@ namespace vamp::robots
             //
 
             // wrist_flex_link
-            if (sphere_environment_in_collision(environment, y[480], y[481], y[482], y[483]))
+            if (sphere_environment_in_collision(environment, 5, y[480], y[481], y[482], y[483]))
             {
-                if (sphere_environment_in_collision(environment, y[344], y[345], y[346], y[347]))
+                if (sphere_environment_in_collision(environment, 5, y[344], y[345], y[346], y[347]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[348], y[349], y[350], y[351]))
+                if (sphere_environment_in_collision(environment, 5, y[348], y[349], y[350], y[351]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[352], y[353], y[354], y[355]))
+                if (sphere_environment_in_collision(environment, 5, y[352], y[353], y[354], y[355]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[356], y[357], y[358], y[359]))
+                if (sphere_environment_in_collision(environment, 5, y[356], y[357], y[358], y[359]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[360], y[361], y[362], y[363]))
+                if (sphere_environment_in_collision(environment, 5, y[360], y[361], y[362], y[363]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[364], y[365], y[366], y[367]))
+                if (sphere_environment_in_collision(environment, 5, y[364], y[365], y[366], y[367]))
                 {
                     return false;
                 }
@@ -34986,39 +35009,39 @@ namespace vamp::robots
             //
 
             // forearm_roll_link
-            if (sphere_environment_in_collision(environment, y[476], y[477], y[478], y[479]))
+            if (sphere_environment_in_collision(environment, 6, y[476], y[477], y[478], y[479]))
             {
-                if (sphere_environment_in_collision(environment, y[316], y[317], y[318], y[319]))
+                if (sphere_environment_in_collision(environment, 6, y[316], y[317], y[318], y[319]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[320], y[321], y[322], y[323]))
+                if (sphere_environment_in_collision(environment, 6, y[320], y[321], y[322], y[323]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[324], y[325], y[326], y[327]))
+                if (sphere_environment_in_collision(environment, 6, y[324], y[325], y[326], y[327]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[328], y[329], y[330], y[331]))
+                if (sphere_environment_in_collision(environment, 6, y[328], y[329], y[330], y[331]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[332], y[333], y[334], y[335]))
+                if (sphere_environment_in_collision(environment, 6, y[332], y[333], y[334], y[335]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[336], y[337], y[338], y[339]))
+                if (sphere_environment_in_collision(environment, 6, y[336], y[337], y[338], y[339]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[340], y[341], y[342], y[343]))
+                if (sphere_environment_in_collision(environment, 6, y[340], y[341], y[342], y[343]))
                 {
                     return false;
                 }
@@ -35029,34 +35052,34 @@ namespace vamp::robots
             //
 
             // elbow_flex_link
-            if (sphere_environment_in_collision(environment, y[472], y[473], y[474], y[475]))
+            if (sphere_environment_in_collision(environment, 7, y[472], y[473], y[474], y[475]))
             {
-                if (sphere_environment_in_collision(environment, y[292], y[293], y[294], y[295]))
+                if (sphere_environment_in_collision(environment, 7, y[292], y[293], y[294], y[295]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[296], y[297], y[298], y[299]))
+                if (sphere_environment_in_collision(environment, 7, y[296], y[297], y[298], y[299]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[300], y[301], y[302], y[303]))
+                if (sphere_environment_in_collision(environment, 7, y[300], y[301], y[302], y[303]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[304], y[305], y[306], y[307]))
+                if (sphere_environment_in_collision(environment, 7, y[304], y[305], y[306], y[307]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[308], y[309], y[310], y[311]))
+                if (sphere_environment_in_collision(environment, 7, y[308], y[309], y[310], y[311]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[312], y[313], y[314], y[315]))
+                if (sphere_environment_in_collision(environment, 7, y[312], y[313], y[314], y[315]))
                 {
                     return false;
                 }
@@ -35067,44 +35090,44 @@ namespace vamp::robots
             //
 
             // upperarm_roll_link
-            if (sphere_environment_in_collision(environment, y[468], y[469], y[470], y[471]))
+            if (sphere_environment_in_collision(environment, 8, y[468], y[469], y[470], y[471]))
             {
-                if (sphere_environment_in_collision(environment, y[260], y[261], y[262], y[263]))
+                if (sphere_environment_in_collision(environment, 8, y[260], y[261], y[262], y[263]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[264], y[265], y[266], y[267]))
+                if (sphere_environment_in_collision(environment, 8, y[264], y[265], y[266], y[267]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[268], y[269], y[270], y[271]))
+                if (sphere_environment_in_collision(environment, 8, y[268], y[269], y[270], y[271]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[272], y[273], y[274], y[275]))
+                if (sphere_environment_in_collision(environment, 8, y[272], y[273], y[274], y[275]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[276], y[277], y[278], y[279]))
+                if (sphere_environment_in_collision(environment, 8, y[276], y[277], y[278], y[279]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[280], y[281], y[282], y[283]))
+                if (sphere_environment_in_collision(environment, 8, y[280], y[281], y[282], y[283]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[284], y[285], y[286], y[287]))
+                if (sphere_environment_in_collision(environment, 8, y[284], y[285], y[286], y[287]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[288], y[289], y[290], y[291]))
+                if (sphere_environment_in_collision(environment, 8, y[288], y[289], y[290], y[291]))
                 {
                     return false;
                 }
@@ -35115,39 +35138,39 @@ namespace vamp::robots
             //
 
             // shoulder_lift_link
-            if (sphere_environment_in_collision(environment, y[464], y[465], y[466], y[467]))
+            if (sphere_environment_in_collision(environment, 9, y[464], y[465], y[466], y[467]))
             {
-                if (sphere_environment_in_collision(environment, y[232], y[233], y[234], y[235]))
+                if (sphere_environment_in_collision(environment, 9, y[232], y[233], y[234], y[235]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[236], y[237], y[238], y[239]))
+                if (sphere_environment_in_collision(environment, 9, y[236], y[237], y[238], y[239]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[240], y[241], y[242], y[243]))
+                if (sphere_environment_in_collision(environment, 9, y[240], y[241], y[242], y[243]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[244], y[245], y[246], y[247]))
+                if (sphere_environment_in_collision(environment, 9, y[244], y[245], y[246], y[247]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[248], y[249], y[250], y[251]))
+                if (sphere_environment_in_collision(environment, 9, y[248], y[249], y[250], y[251]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[252], y[253], y[254], y[255]))
+                if (sphere_environment_in_collision(environment, 9, y[252], y[253], y[254], y[255]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[256], y[257], y[258], y[259]))
+                if (sphere_environment_in_collision(environment, 9, y[256], y[257], y[258], y[259]))
                 {
                     return false;
                 }
@@ -35158,24 +35181,24 @@ namespace vamp::robots
             //
 
             // shoulder_pan_link
-            if (sphere_environment_in_collision(environment, y[460], y[461], y[462], y[463]))
+            if (sphere_environment_in_collision(environment, 10, y[460], y[461], y[462], y[463]))
             {
-                if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+                if (sphere_environment_in_collision(environment, 10, y[216], y[217], y[218], y[219]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+                if (sphere_environment_in_collision(environment, 10, y[220], y[221], y[222], y[223]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+                if (sphere_environment_in_collision(environment, 10, y[224], y[225], y[226], y[227]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[228], y[229], y[230], y[231]))
+                if (sphere_environment_in_collision(environment, 10, y[228], y[229], y[230], y[231]))
                 {
                     return false;
                 }
@@ -35186,144 +35209,144 @@ namespace vamp::robots
             //
 
             // head_pan_link
-            if (sphere_environment_in_collision(environment, y[456], y[457], y[458], y[459]))
+            if (sphere_environment_in_collision(environment, 11, y[456], y[457], y[458], y[459]))
             {
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 11, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 11, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 11, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 11, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 11, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 11, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 11, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 11, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 11, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 11, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 11, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 11, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 11, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 11, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+                if (sphere_environment_in_collision(environment, 11, y[160], y[161], y[162], y[163]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+                if (sphere_environment_in_collision(environment, 11, y[164], y[165], y[166], y[167]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+                if (sphere_environment_in_collision(environment, 11, y[168], y[169], y[170], y[171]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+                if (sphere_environment_in_collision(environment, 11, y[172], y[173], y[174], y[175]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+                if (sphere_environment_in_collision(environment, 11, y[176], y[177], y[178], y[179]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+                if (sphere_environment_in_collision(environment, 11, y[180], y[181], y[182], y[183]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+                if (sphere_environment_in_collision(environment, 11, y[184], y[185], y[186], y[187]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+                if (sphere_environment_in_collision(environment, 11, y[188], y[189], y[190], y[191]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+                if (sphere_environment_in_collision(environment, 11, y[192], y[193], y[194], y[195]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+                if (sphere_environment_in_collision(environment, 11, y[196], y[197], y[198], y[199]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+                if (sphere_environment_in_collision(environment, 11, y[200], y[201], y[202], y[203]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+                if (sphere_environment_in_collision(environment, 11, y[204], y[205], y[206], y[207]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+                if (sphere_environment_in_collision(environment, 11, y[208], y[209], y[210], y[211]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+                if (sphere_environment_in_collision(environment, 11, y[212], y[213], y[214], y[215]))
                 {
                     return false;
                 }
@@ -35334,34 +35357,34 @@ namespace vamp::robots
             //
 
             // torso_lift_link
-            if (sphere_environment_in_collision(environment, y[452], y[453], y[454], y[455]))
+            if (sphere_environment_in_collision(environment, 12, y[452], y[453], y[454], y[455]))
             {
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 12, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 12, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 12, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 12, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 12, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 12, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
@@ -35372,34 +35395,34 @@ namespace vamp::robots
             //
 
             // torso_fixed_link
-            if (sphere_environment_in_collision(environment, y[448], y[449], y[450], y[451]))
+            if (sphere_environment_in_collision(environment, 13, y[448], y[449], y[450], y[451]))
             {
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 13, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 13, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 13, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 13, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 13, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 13, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
@@ -35410,74 +35433,74 @@ namespace vamp::robots
             //
 
             // base_link
-            if (sphere_environment_in_collision(environment, y[444], y[445], y[446], y[447]))
+            if (sphere_environment_in_collision(environment, 14, y[444], y[445], y[446], y[447]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 14, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 14, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 14, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 14, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 14, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 14, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 14, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 14, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 14, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 14, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 14, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 14, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 14, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 14, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
@@ -51621,8 +51644,23 @@ namespace vamp::robots
 
         inline static auto eefk(const std::array<float, 8> &x) noexcept -> Eigen::Isometry3f
         {
-            std::array<float, 23> v;
-            std::array<float, 12> y;
+            return to_isometry(eefk_transform<float>(x).data());
+        }
+
+        // End-effector poses of a block of configurations, one per lane, as the translation followed by the
+        // column-major rotation
+        template <std::size_t rake>
+        inline static auto
+        eefk(const ConfigurationBlock<rake> &x) noexcept -> std::array<FloatVector<rake>, 12>
+        {
+            return eefk_transform<FloatVector<rake>>(x);
+        }
+
+        template <typename DataT, typename InputT>
+        inline static auto eefk_transform(const InputT &x) noexcept -> std::array<DataT, 12>
+        {
+            std::array<DataT, 23> v;
+            std::array<DataT, 12> y;
 
             v[0] = cos(x[1]);
             v[1] = cos(x[2]);
@@ -51686,7 +51724,7 @@ namespace vamp::robots
             y[10] = v[7] * v[14] + v[0] * v[9];
             y[11] = v[10] * v[14] + v[16] * v[9];
 
-            return to_isometry(y.data());
+            return y;
         }
     };
 }  // namespace vamp::robots
@@ -0,0 +1,868 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/validity.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/vector.hh>
+#include <vamp/vector/math.hh>
+
+namespace vamp::robots
+{
+    // A kinematic tree and its sphere model, as loaded from a model file. Model files are plain text, one
+    // entry per line, with fields separated by whitespace and everything after a '#' ignored:
+    //
+    //   name <robot name>
+    //   link <name> <parent or -> <x y z> <roll pitch yaw> fixed
+    //   link <name> <parent or -> <x y z> <roll pitch yaw> revolute|prismatic <joint> <ax ay az> <lo> <hi>
+    //   sphere <link> <x y z> <radius>
+    //   collide <link> <link>
+    //   attach <link>
+    //   end_effector <link>
+    //
+    // As in URDF, a link is placed at its origin (a translation, then fixed-axis roll, pitch, and yaw) in
+    // the frame of its parent, then moved by its joint about or along the axis, which is given in the link's
+    // frame. Parents must be declared before their children. Actuated joints form the configuration in the
+    // order they are declared. Spheres are given in the frame of their link, and are reordered by link, in
+    // declaration order. Only the spheres of link pairs listed with collide are checked against each other,
+    // and only links listed with attach are checked against objects attached to the end effector, or every
+    // link if none are. If no end effector is given, it is the last link.
+    struct KinematicModel
+    {
+        // Transforms are stored as the translation followed by the column-major rotation
+        using Transform = std::array<float, 12>;
+
+        static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+        enum class Joint
+        {
+            Fixed,
+            Revolute,
+            Prismatic
+        };
+
+        struct Link
+        {
+            std::string name;
+            std::size_t parent = none;
+            Transform origin = {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1};
+            Joint joint = Joint::Fixed;
+            std::string joint_name;
+            std::array<float, 3> axis = {0, 0, 1};
+            float lower = 0.F;
+            float upper = 0.F;
+        };
+
+        struct Sphere
+        {
+            std::size_t link;
+            float x;
+            float y;
+            float z;
+            float r;
+        };
+
+        std::string name = "generic";
+        std::vector<Link> links;
+        std::vector<Sphere> spheres;
+        std::vector<std::pair<std::size_t, std::size_t>> collisions;
+        std::vector<std::size_t> attached;
+        std::size_t end_effector = none;
+
+        [[nodiscard]] inline auto dimension() const noexcept -> std::size_t
+        {
+            return std::count_if(
+                links.cbegin(), links.cend(), [](const auto &link) { return link.joint != Joint::Fixed; });
+        }
+
+        [[nodiscard]] inline auto link(const std::string &link_name) const -> std::size_t
+        {
+            for (auto i = 0U; i < links.size(); ++i)
+            {
+                if (links[i].name == link_name)
+                {
+                    return i;
+                }
+            }
+
+            throw std::runtime_error("Unknown link " + link_name + "!");
+        }
+
+        inline static auto load(const std::string &filename) -> KinematicModel
+        {
+            std::ifstream file(filename);
+            if (not file)
+            {
+                throw std::runtime_error("Could not open model " + filename + "!");
+            }
+
+            return parse(file);
+        }
+
+        inline static auto parse(std::istream &input) -> KinematicModel
+        {
+            KinematicModel model;
+            std::string end_effector;
+
+            std::string line;
+            for (auto number = 1U; std::getline(input, line); ++number)
+            {
+                std::istringstream fields(line.substr(0, line.find('#')));
+                const auto error = [number](const std::string &message)
+                { return std::runtime_error("Line " + std::to_string(number) + ": " + message + "!"); };
+
+                std::string keyword;
+                if (not(fields >> keyword))
+                {
+                    continue;
+                }
+
+                if (keyword == "name")
+                {
+                    fields >> model.name;
+                }
+                else if (keyword == "link")
+                {
+                    Link link;
+                    std::string parent, joint;
+                    std::array<float, 3> xyz, rpy;
+                    if (not(fields >> link.name >> parent >> xyz[0] >> xyz[1] >> xyz[2] >> rpy[0] >> rpy[1] >>
+                            rpy[2] >> joint))
+                    {
+                        throw error("Malformed link");
+                    }
+
+                    if (std::any_of(
+                            model.links.cbegin(),
+                            model.links.cend(),
+                            [&link](const auto &other) { return other.name == link.name; }))
+                    {
+                        throw error("Duplicate link " + link.name);
+                    }
+
+                    if (parent != "-")
+                    {
+                        link.parent = model.link(parent);
+                    }
+
+                    link.origin = origin(xyz, rpy);
+
+                    if (joint == "revolute" or joint == "prismatic")
+                    {
+                        link.joint = (joint == "revolute") ? Joint::Revolute : Joint::Prismatic;
+                        auto &a = link.axis;
+                        if (not(fields >> link.joint_name >> a[0] >> a[1] >> a[2] >> link.lower >>
+                                link.upper))
+                        {
+                            throw error("Malformed joint of link " + link.name);
+                        }
+
+                        const auto norm = std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+                        if (not(norm > 0.F) or not(link.lower <= link.upper))
+                        {
+                            throw error("Invalid joint of link " + link.name);
+                        }
+
+                        for (auto &c : a)
+                        {
+                            c /= norm;
+                        }
+                    }
+                    else if (joint != "fixed")
+                    {
+                        throw error("Unknown joint type " + joint);
+                    }
+
+                    model.links.emplace_back(std::move(link));
+                }
+                else if (keyword == "sphere")
+                {
+                    std::string link;
+                    Sphere sphere{};
+                    if (not(fields >> link >> sphere.x >> sphere.y >> sphere.z >> sphere.r) or
+                        not(sphere.r >= 0.F))
+                    {
+                        throw error("Malformed sphere");
+                    }
+
+                    sphere.link = model.link(link);
+                    model.spheres.emplace_back(sphere);
+                }
+                else if (keyword == "collide")
+                {
+                    std::string a, b;
+                    if (not(fields >> a >> b))
+                    {
+                        throw error("Malformed collision pair");
+                    }
+
+                    model.collisions.emplace_back(model.link(a), model.link(b));
+                }
+                else if (keyword == "attach")
+                {
+                    std::string link;
+                    if (not(fields >> link))
+                    {
+                        throw error("Malformed attachment link");
+                    }
+
+                    model.attached.emplace_back(model.link(link));
+                }
+                else if (keyword == "end_effector")
+                {
+                    fields >> end_effector;
+                }
+                else
+                {
+                    throw error("Unknown entry " + keyword);
+                }
+            }
+
+            if (model.links.empty())
+            {
+                throw std::runtime_error("Model has no links!");
+            }
+
+            model.end_effector = (end_effector.empty()) ? model.links.size() - 1 : model.link(end_effector);
+
+            std::stable_sort(
+                model.spheres.begin(),
+                model.spheres.end(),
+                [](const auto &a, const auto &b) { return a.link < b.link; });
+
+            return model;
+        }
+
+        // Transform of a translation followed by fixed-axis rotations about x, y, then z
+        inline static auto origin(const std::array<float, 3> &xyz, const std::array<float, 3> &rpy) noexcept
+            -> Transform
+        {
+            const auto cr = std::cos(rpy[0]), sr = std::sin(rpy[0]);
+            const auto cp = std::cos(rpy[1]), sp = std::sin(rpy[1]);
+            const auto cy = std::cos(rpy[2]), sy = std::sin(rpy[2]);
+
+            return {
+                xyz[0],
+                xyz[1],
+                xyz[2],
+                cy * cp,
+                sy * cp,
+                -sp,
+                cy * sp * sr - sy * cr,
+                sy * sp * sr + cy * cr,
+                cp * sr,
+                cy * sp * cr + sy * sr,
+                sy * sp * cr - cy * sr,
+                cp * cr};
+        }
+    };
+
+    // A robot whose kinematics and collision model are loaded at runtime from a KinematicModel, rather than
+    // generated into a header. Its degrees of freedom and numbers of spheres and links are fixed at compile
+    // time so that blocks and spheres keep the layout of generated robots, and a model must match them when
+    // it is set. Distinct robots with the same counts are distinguished by a tag type.
+    //
+    // Forward kinematics composes the transforms of the tree a block at a time, one configuration per lane.
+    // Collision checks mirror generated robots: each link is culled against the environment by a sphere
+    // bounding all of its spheres before they are checked, distal links first, and link pairs are culled
+    // the same way for self-collisions. Sphere radii are inflated by the bound robots::Instance.
+    //
+    // Setting a model is not thread-safe, and must happen before the robot is used.
+    template <std::size_t dof, std::size_t sphere_count, std::size_t link_count, typename Tag = void>
+    struct Generic
+    {
+        static constexpr std::size_t dimension = dof;
+        static constexpr std::size_t n_spheres = sphere_count;
+        static constexpr std::size_t n_links = link_count;
+        static constexpr std::size_t resolution = 32;
+
+        inline static std::string name = "generic";
+        // Radii without inflation; see Instance::min_max_radii()
+        inline static float min_radius = 0.F;
+        inline static float max_radius = 0.F;
+        static constexpr bool inflatable = true;
+
+        using Configuration = FloatVector<dimension>;
+        using ConfigurationArray = std::array<FloatT, dimension>;
+
+        struct alignas(FloatVectorAlignment) ConfigurationBuffer
+          : std::array<float, Configuration::num_scalars_rounded>
+        {
+        };
+
+        template <std::size_t rake>
+        using ConfigurationBlock = FloatVector<rake, dimension>;
+
+        template <std::size_t rake>
+        struct Spheres
+        {
+            FloatVector<rake, n_spheres> x;
+            FloatVector<rake, n_spheres> y;
+            FloatVector<rake, n_spheres> z;
+            FloatVector<rake, n_spheres> r;
+        };
+
+        template <typename DataT>
+        using Transform = std::array<DataT, 12>;
+
+        inline static std::array<std::string, dimension> joint_names;
+        inline static std::array<std::string, n_links> link_names;
+        inline static std::array<std::size_t, n_spheres> sphere_links;
+        inline static std::string end_effector;
+
+        // Default bounds, as scale factors from the unit cube
+        alignas(Configuration::S::Alignment) inline static std::array<float, dimension> s_m;
+        alignas(Configuration::S::Alignment) inline static std::array<float, dimension> s_a;
+
+        inline static void load(const std::string &filename)
+        {
+            set_model(KinematicModel::load(filename));
+        }
+
+        inline static void set_model(const KinematicModel &model)
+        {
+            if (model.dimension() != dimension or model.spheres.size() != n_spheres or
+                model.links.size() != n_links)
+            {
+                throw std::runtime_error(
+                    "Model " + model.name + " has " + std::to_string(model.dimension()) + " joints, " +
+                    std::to_string(model.spheres.size()) + " spheres, and " +
+                    std::to_string(model.links.size()) + " links, which do not match the robot!");
+            }
+
+            name = model.name;
+            end_effector = model.links[model.end_effector].name;
+            end_effector_link = model.end_effector;
+
+            for (auto i = 0U, joint = 0U; i < n_links; ++i)
+            {
+                const auto &link = model.links[i];
+                auto &c = chain[i];
+
+                link_names[i] = link.name;
+                c.parent = link.parent;
+                c.origin = link.origin;
+                c.translation_only = std::equal(
+                    link.origin.cbegin() + 3, link.origin.cend(), KinematicModel::Link{}.origin.cbegin() + 3);
+                c.joint = link.joint;
+                c.axis = link.axis;
+
+                // Joints about or along a principal axis, as most are, skip the general rotation
+                c.principal = 3;
+                for (auto k = 0U; k < 3; ++k)
+                {
+                    if (std::abs(link.axis[k]) == 1.F)
+                    {
+                        c.principal = k;
+                    }
+                }
+
+                if (link.joint != KinematicModel::Joint::Fixed)
+                {
+                    c.index = joint;
+                    joint_names[joint] = link.joint_name;
+                    s_m[joint] = link.upper - link.lower;
+                    s_a[joint] = link.lower;
+                    ++joint;
+                }
+            }
+
+            min_radius = std::numeric_limits<float>::max();
+            max_radius = 0.F;
+            for (auto i = 0U; i < n_spheres; ++i)
+            {
+                const auto &s = model.spheres[i];
+                sphere_links[i] = s.link;
+                local_spheres[i] = {s.x, s.y, s.z, s.r};
+                min_radius = std::min(min_radius, s.r);
+                max_radius = std::max(max_radius, s.r);
+            }
+
+            // Bounding sphere of each link, about the centroid of its spheres
+            for (auto i = 0U; i < n_links; ++i)
+            {
+                auto &c = chain[i];
+                const auto begin = std::lower_bound(sphere_links.cbegin(), sphere_links.cend(), i);
+                const auto end = std::upper_bound(begin, sphere_links.cend(), i);
+                c.begin = begin - sphere_links.cbegin();
+                c.end = end - sphere_links.cbegin();
+                c.bound = {0, 0, 0, 0};
+                if (c.begin == c.end)
+                {
+                    continue;
+                }
+
+                for (auto j = c.begin; j < c.end; ++j)
+                {
+                    for (auto k = 0U; k < 3; ++k)
+                    {
+                        c.bound[k] += local_spheres[j][k] / static_cast<float>(c.end - c.begin);
+                    }
+                }
+
+                for (auto j = c.begin; j < c.end; ++j)
+                {
+                    const auto &s = local_spheres[j];
+                    const auto dx = s[0] - c.bound[0], dy = s[1] - c.bound[1], dz = s[2] - c.bound[2];
+                    c.bound[3] = std::max(c.bound[3], std::sqrt(dx * dx + dy * dy + dz * dz) + s[3]);
+                }
+            }
+
+            // Links are checked against the environment distal links first, as they move the most
+            const auto has_spheres = [](std::size_t i) { return chain[i].begin != chain[i].end; };
+            environment_links.clear();
+            for (auto i = n_links; i-- > 0;)
+            {
+                if (has_spheres(i))
+                {
+                    environment_links.emplace_back(i);
+                }
+            }
+
+            attachment_links.clear();
+            std::copy_if(
+                model.attached.cbegin(),
+                model.attached.cend(),
+                std::back_inserter(attachment_links),
+                has_spheres);
+            if (model.attached.empty())
+            {
+                attachment_links = environment_links;
+            }
+
+            collisions.clear();
+            for (const auto &[a, b] : model.collisions)
+            {
+                if (has_spheres(a) and has_spheres(b))
+                {
+                    collisions.emplace_back(a, b);
+                }
+            }
+
+            Instance<Generic>::defaults() = Instance<Generic>();
+        }
+
+        inline static void scale_configuration(Configuration &q) noexcept
+        {
+            Instance<Generic>::current().scale_configuration(q);
+        }
+
+        inline static void descale_configuration(Configuration &q) noexcept
+        {
+            Instance<Generic>::current().descale_configuration(q);
+        }
+
+        template <std::size_t rake>
+        inline static void scale_configuration_block(ConfigurationBlock<rake> &q) noexcept
+        {
+            Instance<Generic>::current().template scale_configuration_block<rake>(q);
+        }
+
+        template <std::size_t rake>
+        inline static void descale_configuration_block(ConfigurationBlock<rake> &q) noexcept
+        {
+            Instance<Generic>::current().template descale_configuration_block<rake>(q);
+        }
+
+        // Volume of the current bounds, as for generated robots
+        inline static auto space_measure() noexcept -> float
+        {
+            const auto &instance = Instance<Generic>::current();
+            const auto lows = instance.lows();
+            const auto highs = instance.highs();
+
+            float measure = 1.F;
+            for (auto i = 0U; i < dimension; ++i)
+            {
+                measure *= highs[i] - lows[i];
+            }
+
+            return measure;
+        }
+
+        template <std::size_t rake>
+        inline static void sphere_fk(const ConfigurationBlock<rake> &x, Spheres<rake> &out) noexcept
+        {
+            std::array<Transform<FloatVector<rake>>, n_links> poses;
+            forward_kinematics<FloatVector<rake>>(x, poses);
+
+            const auto inflation = Instance<Generic>::current().inflation;
+            for (auto i = 0U; i < n_spheres; ++i)
+            {
+                const auto s = transform_sphere(poses[sphere_links[i]], local_spheres[i], inflation);
+                out.x[i] = s[0];
+                out.y[i] = s[1];
+                out.z[i] = s[2];
+                out.r[i] = s[3];
+            }
+        }
+
+        template <std::size_t rake>
+        inline static bool fkcc(
+            const vamp::collision::Environment<FloatVector<rake>> &environment,
+            const ConfigurationBlock<rake> &x) noexcept
+        {
+            std::array<Transform<FloatVector<rake>>, n_links> poses;
+            forward_kinematics<FloatVector<rake>>(x, poses);
+
+            Posed<FloatVector<rake>> posed;
+            pose_spheres(poses, Instance<Generic>::current().inflation, posed);
+            return not environment_collision(environment, posed) and not self_collision(posed);
+        }
+
+        template <std::size_t rake>
+        inline static bool fkcc_attach(
+            const vamp::collision::Environment<FloatVector<rake>> &environment,
+            const ConfigurationBlock<rake> &x) noexcept
+        {
+            using DataT = FloatVector<rake>;
+
+            std::array<Transform<DataT>, n_links> poses;
+            forward_kinematics<DataT>(x, poses);
+
+            Posed<DataT> posed;
+            pose_spheres(poses, Instance<Generic>::current().inflation, posed);
+            if (environment_collision(environment, posed) or self_collision(posed))
+            {
+                return false;
+            }
+
+            set_attachment_pose(environment, to_isometry(poses[end_effector_link].data()));
+            if (attachment_environment_collision(environment))
+            {
+                return false;
+            }
+
+            return not for_each_sphere(
+                posed,
+                attachment_links,
+                [&environment](std::size_t, const auto &s)
+                { return attachment_sphere_collision<DataT>(environment, s[0], s[1], s[2], s[3]); });
+        }
+
+        using Debug = std::
+            pair<std::vector<std::vector<std::string>>, std::vector<std::pair<std::size_t, std::size_t>>>;
+
+        template <std::size_t rake>
+        inline static auto fkcc_debug(
+            const vamp::collision::Environment<FloatVector<rake>> &environment,
+            const ConfigurationBlock<rake> &x) noexcept -> Debug
+        {
+            using DataT = FloatVector<rake>;
+
+            Debug output;
+            Spheres<rake> spheres;
+            sphere_fk<rake>(x, spheres);
+
+            for (auto i = 0U; i < n_spheres; ++i)
+            {
+                output.first.emplace_back(sphere_environment_get_collisions<DataT>(
+                    environment, spheres.x[i], spheres.y[i], spheres.z[i], spheres.r[i]));
+            }
+
+            for (const auto &[a, b] : collisions)
+            {
+                for (auto i = chain[a].begin; i < chain[a].end; ++i)
+                {
+                    for (auto j = chain[b].begin; j < chain[b].end; ++j)
+                    {
+                        if (sphere_sphere_self_collision<DataT>(
+                                spheres.x[i],
+                                spheres.y[i],
+                                spheres.z[i],
+                                spheres.r[i],
+                                spheres.x[j],
+                                spheres.y[j],
+                                spheres.z[j],
+                                spheres.r[j]))
+                        {
+                            output.second.emplace_back(i, j);
+                        }
+                    }
+                }
+            }
+
+            return output;
+        }
+
+        inline static auto eefk(const std::array<float, dimension> &x) noexcept -> Eigen::Isometry3f
+        {
+            std::array<Transform<float>, n_links> poses;
+            forward_kinematics<float>(x, poses);
+            return to_isometry(poses[end_effector_link].data());
+        }
+
+        // End-effector poses of a block of configurations, one per lane, as the translation followed by the
+        // column-major rotation
+        template <std::size_t rake>
+        inline static auto
+        eefk(const ConfigurationBlock<rake> &x) noexcept -> std::array<FloatVector<rake>, 12>
+        {
+            std::array<Transform<FloatVector<rake>>, n_links> poses;
+            forward_kinematics<FloatVector<rake>>(x, poses);
+            return poses[end_effector_link];
+        }
+
+        // Poses of every link, composed down the tree in declaration order
+        template <typename DataT, typename InputT>
+        inline static void
+        forward_kinematics(const InputT &x, std::array<Transform<DataT>, n_links> &poses) noexcept
+        {
+            for (auto i = 0U; i < n_links; ++i)
+            {
+                const auto &c = chain[i];
+                auto &pose = poses[i];
+
+                if (c.parent == KinematicModel::none)
+                {
+                    std::copy(c.origin.cbegin(), c.origin.cend(), pose.begin());
+                }
+                else
+                {
+                    compose(poses[c.parent], c, pose);
+                }
+
+                if (c.joint == KinematicModel::Joint::Revolute)
+                {
+                    rotate(pose, c, DataT(x[c.index]));
+                }
+                else if (c.joint == KinematicModel::Joint::Prismatic)
+                {
+                    const auto q = DataT(x[c.index]);
+                    for (auto k = 0U; k < 3; ++k)
+                    {
+                        pose[k] = pose[k] + q * (pose[3 + k] * c.axis[0] + pose[6 + k] * c.axis[1] +
+                                                 pose[9 + k] * c.axis[2]);
+                    }
+                }
+            }
+        }
+
+    private:
+        struct ChainLink
+        {
+            std::size_t parent = KinematicModel::none;
+            KinematicModel::Transform origin;
+            bool translation_only = true;
+            KinematicModel::Joint joint = KinematicModel::Joint::Fixed;
+            std::array<float, 3> axis;
+            std::size_t principal = 3;
+            std::size_t index = 0;
+
+            // Range of the link's spheres, and the sphere bounding them in the link's frame
+            std::size_t begin = 0;
+            std::size_t end = 0;
+            std::array<float, 4> bound;
+        };
+
+        inline static std::array<ChainLink, n_links> chain;
+        inline static std::array<std::array<float, 4>, n_spheres> local_spheres;
+        inline static std::vector<std::size_t> environment_links;
+        inline static std::vector<std::size_t> attachment_links;
+        inline static std::vector<std::pair<std::size_t, std::size_t>> collisions;
+        inline static std::size_t end_effector_link = 0;
+
+        // Pose of a link at its origin in the frame of its parent
+        template <typename DataT>
+        inline static void
+        compose(const Transform<DataT> &parent, const ChainLink &c, Transform<DataT> &out) noexcept
+        {
+            const auto &o = c.origin;
+            for (auto k = 0U; k < 3; ++k)
+            {
+                out[k] = parent[k] + parent[3 + k] * o[0] + parent[6 + k] * o[1] + parent[9 + k] * o[2];
+            }
+
+            if (c.translation_only)
+            {
+                std::copy(parent.cbegin() + 3, parent.cend(), out.begin() + 3);
+                return;
+            }
+
+            for (auto j = 0U; j < 3; ++j)
+            {
+                for (auto k = 0U; k < 3; ++k)
+                {
+                    out[3 + 3 * j + k] = parent[3 + k] * o[3 + 3 * j] + parent[6 + k] * o[4 + 3 * j] +
+                                         parent[9 + k] * o[5 + 3 * j];
+                }
+            }
+        }
+
+        // Rotates a pose about the axis of its link's joint
+        template <typename DataT>
+        inline static void rotate(Transform<DataT> &pose, const ChainLink &c, const DataT &q) noexcept
+        {
+            const auto cq = cos(q);
+            const auto sq = sin(q);
+
+            if (c.principal < 3)
+            {
+                // Only the two columns orthogonal to the axis turn
+                const auto s = (c.axis[c.principal] < 0.F) ? -sq : sq;
+                const auto u = 3 + 3 * ((c.principal + 1) % 3);
+                const auto v = 3 + 3 * ((c.principal + 2) % 3);
+                for (auto k = 0U; k < 3; ++k)
+                {
+                    const auto pu = pose[u + k];
+                    const auto pv = pose[v + k];
+                    pose[u + k] = pu * cq + pv * s;
+                    pose[v + k] = pv * cq - pu * s;
+                }
+
+                return;
+            }
+
+            // Rodrigues' formula, R = cI + sK + (1 - c)aa^T
+            const auto &a = c.axis;
+            const auto t = 1.F - cq;
+            std::array<DataT, 9> r = {
+                cq + t * (a[0] * a[0]),
+                t * (a[0] * a[1]) + sq * a[2],
+                t * (a[0] * a[2]) - sq * a[1],
+                t * (a[0] * a[1]) - sq * a[2],
+                cq + t * (a[1] * a[1]),
+                t * (a[1] * a[2]) + sq * a[0],
+                t * (a[0] * a[2]) + sq * a[1],
+                t * (a[1] * a[2]) - sq * a[0],
+                cq + t * (a[2] * a[2])};
+
+            Transform<DataT> rotated = pose;
+            for (auto j = 0U; j < 3; ++j)
+            {
+                for (auto k = 0U; k < 3; ++k)
+                {
+                    rotated[3 + 3 * j + k] =
+                        pose[3 + k] * r[3 * j] + pose[6 + k] * r[3 * j + 1] + pose[9 + k] * r[3 * j + 2];
+                }
+            }
+
+            pose = rotated;
+        }
+
+        template <typename DataT>
+        inline static auto transform_sphere(
+            const Transform<DataT> &pose,
+            const std::array<float, 4> &s,
+            float inflation) noexcept -> std::array<DataT, 4>
+        {
+            return {
+                pose[0] + pose[3] * s[0] + pose[6] * s[1] + pose[9] * s[2],
+                pose[1] + pose[4] * s[0] + pose[7] * s[1] + pose[10] * s[2],
+                pose[2] + pose[5] * s[0] + pose[8] * s[1] + pose[11] * s[2],
+                DataT(s[3] + inflation)};
+        }
+
+        // Spheres of the robot and the spheres bounding each of its links, in the world frame
+        template <typename DataT>
+        struct Posed
+        {
+            std::array<std::array<DataT, 4>, n_spheres> spheres;
+            std::array<std::array<DataT, 4>, n_links> bounds;
+        };
+
+        template <typename DataT>
+        inline static void pose_spheres(
+            const std::array<Transform<DataT>, n_links> &poses,
+            float inflation,
+            Posed<DataT> &out) noexcept
+        {
+            for (auto i = 0U; i < n_links; ++i)
+            {
+                const auto &c = chain[i];
+                if (c.end - c.begin > 1)
+                {
+                    out.bounds[i] = transform_sphere(poses[i], c.bound, inflation);
+                }
+
+                for (auto j = c.begin; j < c.end; ++j)
+                {
+                    out.spheres[j] = transform_sphere(poses[i], local_spheres[j], inflation);
+                }
+            }
+        }
+
+        // Calls f with each sphere of the given links, culling links with more than one sphere by their
+        // bounding spheres, until f returns true
+        template <typename DataT, typename F>
+        inline static auto for_each_sphere(
+            const Posed<DataT> &posed,
+            const std::vector<std::size_t> &links,
+            const F &f) noexcept -> bool
+        {
+            for (const auto i : links)
+            {
+                const auto &c = chain[i];
+                if (c.end - c.begin > 1 and not f(i, posed.bounds[i]))
+                {
+                    continue;
+                }
+
+                for (auto j = c.begin; j < c.end; ++j)
+                {
+                    if (f(i, posed.spheres[j]))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        template <typename DataT>
+        inline static auto environment_collision(
+            const vamp::collision::Environment<DataT> &environment,
+            const Posed<DataT> &posed) noexcept -> bool
+        {
+            return for_each_sphere(
+                posed,
+                environment_links,
+                [&environment](std::size_t link, const auto &s)
+                { return sphere_environment_in_collision(environment, link, s[0], s[1], s[2], s[3]); });
+        }
+
+        template <typename DataT>
+        inline static auto self_collision(const Posed<DataT> &posed) noexcept -> bool
+        {
+            const auto collide = [](const auto &a, const auto &b)
+            { return sphere_sphere_self_collision<DataT>(a[0], a[1], a[2], a[3], b[0], b[1], b[2], b[3]); };
+
+            for (const auto &[a, b] : collisions)
+            {
+                const auto &ca = chain[a];
+                const auto &cb = chain[b];
+                if (ca.end - ca.begin > 1 and cb.end - cb.begin > 1 and
+                    not collide(posed.bounds[a], posed.bounds[b]))
+                {
+                    continue;
+                }
+
+                for (auto i = ca.begin; i < ca.end; ++i)
+                {
+                    for (auto j = cb.begin; j < cb.end; ++j)
+                    {
+                        if (collide(posed.spheres[i], posed.spheres[j]))
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+
+            return false;
+        }
+    };
+}  // namespace vamp::robots
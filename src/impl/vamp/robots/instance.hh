@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <vamp/vector.hh>
+
+namespace vamp::robots
+{
+    // Whether a robot inflates the radii of its collision spheres by its instance's inflation, which robots
+    // declare with `static constexpr bool inflatable = true`
+    template <typename Robot, typename = void>
+    struct is_inflatable : std::false_type
+    {
+    };
+
+    template <typename Robot>
+    struct is_inflatable<Robot, std::void_t<decltype(Robot::inflatable)>>
+      : std::bool_constant<Robot::inflatable>
+    {
+    };
+
+    // Runtime parameters of a robot: the bounds of its configuration space, and an inflation added to the
+    // radii of its collision spheres. Inflation is only honored by robots whose collision model is not
+    // generated with fixed radii (i.e., robots::Sphere and robots::Generic, which are `inflatable`).
+    //
+    // Robots are static types, so their collision checks cannot carry a reference to an instance through
+    // every planner. Instead, an instance is bound to the calling thread for the extent of a Scope, and
+    // everything that depends on these parameters (samplers, bounds checks, and collision checks of robots
+    // with runtime radii) reads the instance bound to the thread it runs on, or the robot's defaults if none
+    // is bound. Solves on different threads can therefore use different parameters concurrently.
+    template <typename Robot>
+    struct Instance
+    {
+        using Configuration = typename Robot::Configuration;
+        using ConfigurationArray = std::array<float, Robot::dimension>;
+
+        // The robot's own bounds, from its scale factors
+        Instance() noexcept : s_m(Robot::s_m), s_a(Robot::s_a), d_m((1.F / s_m).trim())
+        {
+        }
+
+        Instance(
+            const ConfigurationArray &lows,
+            const ConfigurationArray &highs,
+            float inflation = 0.F) noexcept
+          : s_m(Configuration(highs) - Configuration(lows))
+          , s_a(Configuration(lows))
+          , d_m((1.F / s_m).trim())
+          , inflation(inflation)
+        {
+        }
+
+        // Configurations are scaled from the unit cube as q * s_m + s_a
+        Configuration s_m;
+        Configuration s_a;
+        Configuration d_m;
+        float inflation = 0.F;
+
+        inline void scale_configuration(Configuration &q) const noexcept
+        {
+            q = q * s_m + s_a;
+        }
+
+        inline void descale_configuration(Configuration &q) const noexcept
+        {
+            q = (q - s_a) * d_m;
+        }
+
+        template <std::size_t rake>
+        inline void
+        scale_configuration_block(typename Robot::template ConfigurationBlock<rake> &q) const noexcept
+        {
+            const auto m = s_m.to_array();
+            const auto a = s_a.to_array();
+            for (auto i = 0U; i < Robot::dimension; ++i)
+            {
+                q[i] = a[i] + (q[i] * m[i]);
+            }
+        }
+
+        template <std::size_t rake>
+        inline void
+        descale_configuration_block(typename Robot::template ConfigurationBlock<rake> &q) const noexcept
+        {
+            const auto d = d_m.to_array();
+            const auto a = s_a.to_array();
+            for (auto i = 0U; i < Robot::dimension; ++i)
+            {
+                q[i] = d[i] * (q[i] - a[i]);
+            }
+        }
+
+        [[nodiscard]] inline auto lows() const noexcept -> ConfigurationArray
+        {
+            return to_array(s_a);
+        }
+
+        [[nodiscard]] inline auto highs() const noexcept -> ConfigurationArray
+        {
+            return to_array(s_a + s_m);
+        }
+
+        // Smallest and largest radii of the robot's collision spheres under this instance, e.g., to build a
+        // CAPT for it, as a CAPT must not be queried with radii outside of those it was built for
+        [[nodiscard]] inline auto min_max_radii() const noexcept -> std::pair<float, float>
+        {
+            const auto offset = (is_inflatable<Robot>::value) ? inflation : 0.F;
+            return {Robot::min_radius + offset, Robot::max_radius + offset};
+        }
+
+        // Binds an instance to the calling thread until destroyed, restoring whichever was bound before
+        class Scope
+        {
+        public:
+            explicit Scope(const Instance &instance) noexcept : previous(bound)
+            {
+                bound = &instance;
+            }
+
+            Scope(const Scope &) = delete;
+            auto operator=(const Scope &) -> Scope & = delete;
+
+            ~Scope()
+            {
+                bound = previous;
+            }
+
+        private:
+            const Instance *previous;
+        };
+
+        // Instance bound to the calling thread, or the defaults. Samplers, bounds checks, and the collision
+        // checks of robots with runtime radii call this each time rather than once per solve, which would
+        // need the instance passed through every RNG and collision check. Each call is a thread-local read,
+        // about 2 ns in a shared library such as the Python module, which is about 2% of the sphere robot's
+        // RRTC time and not measurable for generated robots, whose collision checks never read it.
+        inline static auto current() noexcept -> const Instance &
+        {
+            return (bound) ? *bound : defaults();
+        }
+
+        // Used when no instance is bound. Changing the defaults is not thread-safe.
+        inline static auto defaults() noexcept -> Instance &
+        {
+            static Instance instance;
+            return instance;
+        }
+
+    private:
+        inline static auto to_array(const Configuration &v) noexcept -> ConfigurationArray
+        {
+            ConfigurationArray array;
+            const auto padded = v.to_array();
+            std::copy_n(padded.cbegin(), Robot::dimension, array.begin());
+            return array;
+        }
+
+        inline static thread_local const Instance *bound = nullptr;
+    };
+}  // namespace vamp::robots
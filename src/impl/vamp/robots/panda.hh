@@ -13,6 +13,7 @@ namespace vamp::robots
         static constexpr char *name = "panda";
         static constexpr std::size_t dimension = 7;
         static constexpr std::size_t n_spheres = 59;
+        static constexpr std::size_t n_links = 11;
         static constexpr float min_radius = 0.012000000104308128;
         static constexpr float max_radius = 0.07999999821186066;
         static constexpr std::size_t resolution = 32;
@@ -25,6 +26,21 @@ namespace vamp::robots
             "panda_joint5",
             "panda_joint6",
             "panda_joint7"};
+        static constexpr std::array<std::string_view, n_links> link_names = {
+            "panda_rightfinger",
+            "panda_leftfinger",
+            "panda_hand",
+            "panda_link7",
+            "panda_link6",
+            "panda_link5",
+            "panda_link4",
+            "panda_link3",
+            "panda_link2",
+            "panda_link1",
+            "panda_link0"};
+        static constexpr std::array<std::size_t, n_spheres> sphere_links = {
+            10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4,
+            3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 0, 0};
         static constexpr char *end_effector = "panda_grasptarget";
 
         using Configuration = FloatVector<dimension>;
@@ -5631,14 +5647,14 @@ namespace vamp::robots
             //
 
             // panda_rightfinger
-            if (sphere_environment_in_collision(environment, y[276], y[277], y[278], y[279]))
+            if (sphere_environment_in_collision(environment, 0, y[276], y[277], y[278], y[279]))
             {
-                if (sphere_environment_in_collision(environment, y[228], y[229], y[230], y[231]))
+                if (sphere_environment_in_collision(environment, 0, y[228], y[229], y[230], y[231]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[232], y[233], y[234], y[235]))
+                if (sphere_environment_in_collision(environment, 0, y[232], y[233], y[234], y[235]))
                 {
                     return false;
                 }
@@ -5649,14 +5665,14 @@ namespace vamp::robots
             //
 
             // panda_leftfinger
-            if (sphere_environment_in_collision(environment, y[272], y[273], y[274], y[275]))
+            if (sphere_environment_in_collision(environment, 1, y[272], y[273], y[274], y[275]))
             {
-                if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+                if (sphere_environment_in_collision(environment, 1, y[220], y[221], y[222], y[223]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+                if (sphere_environment_in_collision(environment, 1, y[224], y[225], y[226], y[227]))
                 {
                     return false;
                 }
@@ -5667,94 +5683,94 @@ namespace vamp::robots
             //
 
             // panda_hand
-            if (sphere_environment_in_collision(environment, y[268], y[269], y[270], y[271]))
+            if (sphere_environment_in_collision(environment, 2, y[268], y[269], y[270], y[271]))
             {
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 2, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 2, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 2, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+                if (sphere_environment_in_collision(environment, 2, y[160], y[161], y[162], y[163]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+                if (sphere_environment_in_collision(environment, 2, y[164], y[165], y[166], y[167]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+                if (sphere_environment_in_collision(environment, 2, y[168], y[169], y[170], y[171]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+                if (sphere_environment_in_collision(environment, 2, y[172], y[173], y[174], y[175]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+                if (sphere_environment_in_collision(environment, 2, y[176], y[177], y[178], y[179]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+                if (sphere_environment_in_collision(environment, 2, y[180], y[181], y[182], y[183]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+                if (sphere_environment_in_collision(environment, 2, y[184], y[185], y[186], y[187]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+                if (sphere_environment_in_collision(environment, 2, y[188], y[189], y[190], y[191]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+                if (sphere_environment_in_collision(environment, 2, y[192], y[193], y[194], y[195]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+                if (sphere_environment_in_collision(environment, 2, y[196], y[197], y[198], y[199]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+                if (sphere_environment_in_collision(environment, 2, y[200], y[201], y[202], y[203]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+                if (sphere_environment_in_collision(environment, 2, y[204], y[205], y[206], y[207]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+                if (sphere_environment_in_collision(environment, 2, y[208], y[209], y[210], y[211]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+                if (sphere_environment_in_collision(environment, 2, y[212], y[213], y[214], y[215]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+                if (sphere_environment_in_collision(environment, 2, y[216], y[217], y[218], y[219]))
                 {
                     return false;
                 }
@@ -5765,29 +5781,29 @@ namespace vamp::robots
             //
 
             // panda_link7
-            if (sphere_environment_in_collision(environment, y[264], y[265], y[266], y[267]))
+            if (sphere_environment_in_collision(environment, 3, y[264], y[265], y[266], y[267]))
             {
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 3, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 3, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 3, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 3, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 3, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
@@ -5798,19 +5814,19 @@ namespace vamp::robots
             //
 
             // panda_link6
-            if (sphere_environment_in_collision(environment, y[260], y[261], y[262], y[263]))
+            if (sphere_environment_in_collision(environment, 4, y[260], y[261], y[262], y[263]))
             {
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 4, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 4, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 4, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
@@ -5821,64 +5837,64 @@ namespace vamp::robots
             //
 
             // panda_link5
-            if (sphere_environment_in_collision(environment, y[256], y[257], y[258], y[259]))
+            if (sphere_environment_in_collision(environment, 5, y[256], y[257], y[258], y[259]))
             {
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 5, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 5, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 5, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 5, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 5, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 5, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 5, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 5, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 5, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 5, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 5, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 5, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
@@ -5889,24 +5905,24 @@ namespace vamp::robots
             //
 
             // panda_link4
-            if (sphere_environment_in_collision(environment, y[252], y[253], y[254], y[255]))
+            if (sphere_environment_in_collision(environment, 6, y[252], y[253], y[254], y[255]))
             {
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 6, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 6, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 6, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 6, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
@@ -5917,24 +5933,24 @@ namespace vamp::robots
             //
 
             // panda_link3
-            if (sphere_environment_in_collision(environment, y[248], y[249], y[250], y[251]))
+            if (sphere_environment_in_collision(environment, 7, y[248], y[249], y[250], y[251]))
             {
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 7, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 7, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 7, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 7, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
@@ -5945,24 +5961,24 @@ namespace vamp::robots
             //
 
             // panda_link2
-            if (sphere_environment_in_collision(environment, y[244], y[245], y[246], y[247]))
+            if (sphere_environment_in_collision(environment, 8, y[244], y[245], y[246], y[247]))
             {
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 8, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 8, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 8, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 8, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
@@ -5973,24 +5989,24 @@ namespace vamp::robots
             //
 
             // panda_link1
-            if (sphere_environment_in_collision(environment, y[240], y[241], y[242], y[243]))
+            if (sphere_environment_in_collision(environment, 9, y[240], y[241], y[242], y[243]))
             {
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 9, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 9, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 9, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 9, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
@@ -6001,9 +6017,9 @@ namespace vamp::robots
             //
 
             // panda_link0
-            if (sphere_environment_in_collision(environment, y[236], y[237], y[238], y[239]))
+            if (sphere_environment_in_collision(environment, 10, y[236], y[237], y[238], y[239]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 10, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
@@ -10678,14 +10694,14 @@ namespace vamp::robots
             //
 
             // panda_rightfinger
-            if (sphere_environment_in_collision(environment, y[276], y[277], y[278], y[279]))
+            if (sphere_environment_in_collision(environment, 0, y[276], y[277], y[278], y[279]))
             {
-                if (sphere_environment_in_collision(environment, y[228], y[229], y[230], y[231]))
+                if (sphere_environment_in_collision(environment, 0, y[228], y[229], y[230], y[231]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[232], y[233], y[234], y[235]))
+                if (sphere_environment_in_collision(environment, 0, y[232], y[233], y[234], y[235]))
                 {
                     return false;
                 }
@@ -10696,14 +10712,14 @@ namespace vamp::robots
             //
 
             // panda_leftfinger
-            if (sphere_environment_in_collision(environment, y[272], y[273], y[274], y[275]))
+            if (sphere_environment_in_collision(environment, 1, y[272], y[273], y[274], y[275]))
             {
-                if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+                if (sphere_environment_in_collision(environment, 1, y[220], y[221], y[222], y[223]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+                if (sphere_environment_in_collision(environment, 1, y[224], y[225], y[226], y[227]))
                 {
                     return false;
                 }
@@ -10714,94 +10730,94 @@ namespace vamp::robots
             //
 
             // panda_hand
-            if (sphere_environment_in_collision(environment, y[268], y[269], y[270], y[271]))
+            if (sphere_environment_in_collision(environment, 2, y[268], y[269], y[270], y[271]))
             {
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 2, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 2, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 2, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+                if (sphere_environment_in_collision(environment, 2, y[160], y[161], y[162], y[163]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+                if (sphere_environment_in_collision(environment, 2, y[164], y[165], y[166], y[167]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+                if (sphere_environment_in_collision(environment, 2, y[168], y[169], y[170], y[171]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+                if (sphere_environment_in_collision(environment, 2, y[172], y[173], y[174], y[175]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+                if (sphere_environment_in_collision(environment, 2, y[176], y[177], y[178], y[179]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+                if (sphere_environment_in_collision(environment, 2, y[180], y[181], y[182], y[183]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+                if (sphere_environment_in_collision(environment, 2, y[184], y[185], y[186], y[187]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+                if (sphere_environment_in_collision(environment, 2, y[188], y[189], y[190], y[191]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+                if (sphere_environment_in_collision(environment, 2, y[192], y[193], y[194], y[195]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+                if (sphere_environment_in_collision(environment, 2, y[196], y[197], y[198], y[199]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+                if (sphere_environment_in_collision(environment, 2, y[200], y[201], y[202], y[203]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+                if (sphere_environment_in_collision(environment, 2, y[204], y[205], y[206], y[207]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+                if (sphere_environment_in_collision(environment, 2, y[208], y[209], y[210], y[211]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+                if (sphere_environment_in_collision(environment, 2, y[212], y[213], y[214], y[215]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+                if (sphere_environment_in_collision(environment, 2, y[216], y[217], y[218], y[219]))
                 {
                     return false;
                 }
@@ -10812,29 +10828,29 @@ namespace vamp::robots
             //
 
             // panda_link7
-            if (sphere_environment_in_collision(environment, y[264], y[265], y[266], y[267]))
+            if (sphere_environment_in_collision(environment, 3, y[264], y[265], y[266], y[267]))
             {
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 3, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 3, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 3, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 3, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 3, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
@@ -10845,19 +10861,19 @@ namespace vamp::robots
             //
 
             // panda_link6
-            if (sphere_environment_in_collision(environment, y[260], y[261], y[262], y[263]))
+            if (sphere_environment_in_collision(environment, 4, y[260], y[261], y[262], y[263]))
             {
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 4, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 4, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 4, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
@@ -10868,64 +10884,64 @@ namespace vamp::robots
             //
 
             // panda_link5
-            if (sphere_environment_in_collision(environment, y[256], y[257], y[258], y[259]))
+            if (sphere_environment_in_collision(environment, 5, y[256], y[257], y[258], y[259]))
             {
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 5, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 5, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 5, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 5, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 5, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 5, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 5, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 5, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 5, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 5, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 5, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 5, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
@@ -10936,24 +10952,24 @@ namespace vamp::robots
             //
 
             // panda_link4
-            if (sphere_environment_in_collision(environment, y[252], y[253], y[254], y[255]))
+            if (sphere_environment_in_collision(environment, 6, y[252], y[253], y[254], y[255]))
             {
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 6, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 6, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 6, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 6, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
@@ -10964,24 +10980,24 @@ namespace vamp::robots
             //
 
             // panda_link3
-            if (sphere_environment_in_collision(environment, y[248], y[249], y[250], y[251]))
+            if (sphere_environment_in_collision(environment, 7, y[248], y[249], y[250], y[251]))
             {
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 7, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 7, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 7, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 7, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
@@ -10992,24 +11008,24 @@ namespace vamp::robots
             //
 
             // panda_link2
-            if (sphere_environment_in_collision(environment, y[244], y[245], y[246], y[247]))
+            if (sphere_environment_in_collision(environment, 8, y[244], y[245], y[246], y[247]))
             {
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 8, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 8, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 8, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 8, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
@@ -11020,24 +11036,24 @@ namespace vamp::robots
             //
 
             // panda_link1
-            if (sphere_environment_in_collision(environment, y[240], y[241], y[242], y[243]))
+            if (sphere_environment_in_collision(environment, 9, y[240], y[241], y[242], y[243]))
             {
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 9, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 9, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 9, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 9, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
@@ -11048,9 +11064,9 @@ namespace vamp::robots
             //
 
             // panda_link0
-            if (sphere_environment_in_collision(environment, y[236], y[237], y[238], y[239]))
+            if (sphere_environment_in_collision(environment, 10, y[236], y[237], y[238], y[239]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 10, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
@@ -15446,8 +15462,23 @@ namespace vamp::robots
 
         inline static auto eefk(const std::array<float, 7> &x) noexcept -> Eigen::Isometry3f
         {
-            std::array<float, 36> v;
-            std::array<float, 12> y;
+            return to_isometry(eefk_transform<float>(x).data());
+        }
+
+        // End-effector poses of a block of configurations, one per lane, as the translation followed by the
+        // column-major rotation
+        template <std::size_t rake>
+        inline static auto
+        eefk(const ConfigurationBlock<rake> &x) noexcept -> std::array<FloatVector<rake>, 12>
+        {
+            return eefk_transform<FloatVector<rake>>(x);
+        }
+
+        template <typename DataT, typename InputT>
+        inline static auto eefk_transform(const InputT &x) noexcept -> std::array<DataT, 12>
+        {
+            std::array<DataT, 36> v;
+            std::array<DataT, 12> y;
 
             v[0] = cos(x[0]);
             v[1] = sin(x[1]);
@@ -15548,7 +15579,7 @@ namespace vamp::robots
             y[7] = 0.70710678118623 * v[26] + 0.707106781186865 * v[0];
             y[8] = 0.70710678118623 * v[12] + 0.707106781186865 * v[35];
 
-            return to_isometry(y.data());
+            return y;
         }
     };
 }  // namespace vamp::robots
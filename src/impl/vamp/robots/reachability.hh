@@ -0,0 +1,409 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/math.hh>
+#include <vamp/collision/shapes.hh>
+#include <vamp/random/rng.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::robots
+{
+    // Axis-aligned bounds on the space the spheres of one link can occupy within the joint limits.
+    struct LinkReach
+    {
+        collision::Point lower = {
+            std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::max()};
+        collision::Point upper = {
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::lowest()};
+
+        // Squared distance from a point to these bounds, zero inside
+        [[nodiscard]] inline auto sql2(const collision::Point &p) const noexcept -> float
+        {
+            float sum = 0.F;
+            for (auto i = 0U; i < 3; ++i)
+            {
+                const auto d = std::max({lower[i] - p[i], p[i] - upper[i], 0.F});
+                sum += d * d;
+            }
+
+            return sum;
+        }
+
+        // Whether these bounds overlap an axis-aligned box with a given center and half extents
+        [[nodiscard]] inline auto
+        overlaps(const collision::Point &center, const collision::Point &half) const noexcept -> bool
+        {
+            for (auto i = 0U; i < 3; ++i)
+            {
+                if (center[i] + half[i] < lower[i] or center[i] - half[i] > upper[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Each primitive is tested by its own axis-aligned bounds, which is conservative for everything
+        // but spheres
+        [[nodiscard]] inline auto reaches(const collision::Sphere<float> &s) const noexcept -> bool
+        {
+            return sql2({s.x, s.y, s.z}) <= s.r * s.r;
+        }
+
+        [[nodiscard]] inline auto reaches(const collision::Cylinder<float> &c) const noexcept -> bool
+        {
+            return overlaps(
+                {c.x1 + c.xv * 0.5F, c.y1 + c.yv * 0.5F, c.z1 + c.zv * 0.5F},
+                {std::abs(c.xv) * 0.5F + c.r, std::abs(c.yv) * 0.5F + c.r, std::abs(c.zv) * 0.5F + c.r});
+        }
+
+        [[nodiscard]] inline auto reaches(const collision::Cuboid<float> &c) const noexcept -> bool
+        {
+            const auto half = [&c](float a1, float a2, float a3)
+            { return std::abs(a1) * c.axis_1_r + std::abs(a2) * c.axis_2_r + std::abs(a3) * c.axis_3_r; };
+
+            return overlaps(
+                {c.x, c.y, c.z},
+                {half(c.axis_1_x, c.axis_2_x, c.axis_3_x),
+                 half(c.axis_1_y, c.axis_2_y, c.axis_3_y),
+                 half(c.axis_1_z, c.axis_2_z, c.axis_3_z)});
+        }
+    };
+
+    // Largest extent of a link's spheres along an axis in each configuration of a block, upward for a sign of
+    // 1 and downward (negated) for a sign of -1
+    template <typename Robot, std::size_t rake>
+    inline auto link_extent(
+        const typename Robot::template Spheres<rake> &spheres,
+        const std::vector<std::size_t> &members,
+        std::size_t axis,
+        float sign) noexcept -> FloatVector<rake>
+    {
+        auto extent = FloatVector<rake>::fill(std::numeric_limits<float>::lowest());
+        for (const auto i : members)
+        {
+            const auto coordinate = (axis == 0) ? spheres.x[i] : (axis == 1) ? spheres.y[i] : spheres.z[i];
+            extent = extent.max(coordinate * sign + spheres.r[i]);
+        }
+
+        return extent;
+    }
+
+    // Climbs from a configuration (in the unit cube) to a local maximum of a link's extent along an axis by
+    // compass search within the bounds of the current instance, checking every step of an iteration at once
+    template <typename Robot, std::size_t rake>
+    inline auto climb_link_extent(
+        std::array<float, Robot::dimension> start,
+        const std::vector<std::size_t> &members,
+        std::size_t axis,
+        float sign) -> float
+    {
+        using Point = std::array<float, Robot::dimension>;
+        const auto &instance = Instance<Robot>::current();
+
+        typename Robot::template ConfigurationBlock<rake> block;
+        typename Robot::template Spheres<rake> spheres;
+
+        std::vector<float> values;
+        const auto evaluate = [&](const std::vector<Point> &points)
+        {
+            values.clear();
+            for (std::size_t first = 0; first < points.size(); first += rake)
+            {
+                for (auto j = 0U; j < Robot::dimension; ++j)
+                {
+                    // Lanes past the last point repeat it
+                    std::array<float, rake> lanes;
+                    for (auto i = 0U; i < rake; ++i)
+                    {
+                        lanes[i] = points[std::min(first + i, points.size() - 1)][j];
+                    }
+
+                    block[j] = FloatVector<rake>(lanes);
+                }
+
+                instance.template scale_configuration_block<rake>(block);
+                Robot::template sphere_fk<rake>(block, spheres);
+
+                const auto extent = link_extent<Robot, rake>(spheres, members, axis, sign).to_array();
+                for (auto i = 0U; i < rake and first + i < points.size(); ++i)
+                {
+                    values.emplace_back(extent[i]);
+                }
+            }
+        };
+
+        evaluate({start});
+        auto best = values.front();
+
+        std::vector<Point> steps;
+        auto step = 0.125F;
+        for (auto iteration = 0U; iteration < 1000 and step > 1e-4F; ++iteration)
+        {
+            steps.clear();
+            for (auto j = 0U; j < Robot::dimension; ++j)
+            {
+                for (const auto delta : {-step, step})
+                {
+                    auto point = start;
+                    point[j] = std::clamp(point[j] + delta, 0.F, 1.F);
+                    steps.emplace_back(point);
+                }
+            }
+
+            evaluate(steps);
+            const auto it = std::max_element(values.cbegin(), values.cend());
+            if (*it > best)
+            {
+                best = *it;
+                start = steps[it - values.cbegin()];
+            }
+            else
+            {
+                step *= 0.5F;
+            }
+        }
+
+        return best;
+    }
+
+    // Bounds the reach of each link within the bounds of the current instance. Sampling alone only finds
+    // extents short of the true extremes, so each extent of each link is then climbed by compass search from
+    // the best `n_climbs` of `n_seeds` samples, which converges onto the extremes that the joint limits or a
+    // stationary configuration define. The bounds are finally inflated by a margin, which only has to cover
+    // extremes that no sample was close enough to climb to.
+    template <typename Robot, std::size_t rake>
+    inline auto sample_link_reach(
+        std::size_t n_samples,
+        float margin,
+        typename vamp::rng::RNG<Robot>::Ptr rng,
+        std::size_t n_seeds = 4096,
+        std::size_t n_climbs = 4) -> std::vector<LinkReach>
+    {
+        constexpr auto n = Robot::n_spheres;
+
+        const auto lowest = FloatVector<rake>::fill(std::numeric_limits<float>::lowest());
+        std::vector<FloatVector<rake>> lower(3 * n, lowest);
+        std::vector<FloatVector<rake>> upper(3 * n, lowest);
+
+        typename Robot::template Spheres<rake> spheres;
+
+        for (std::size_t sample = 0; sample < n_samples; sample += rake)
+        {
+            Robot::template sphere_fk<rake>(rng->template next_block<rake>(), spheres);
+
+            // Only a vector max is available, so lower bounds are tracked negated
+            for (auto i = 0U; i < n; ++i)
+            {
+                lower[3 * i + 0] = lower[3 * i + 0].max(spheres.r[i] - spheres.x[i]);
+                lower[3 * i + 1] = lower[3 * i + 1].max(spheres.r[i] - spheres.y[i]);
+                lower[3 * i + 2] = lower[3 * i + 2].max(spheres.r[i] - spheres.z[i]);
+                upper[3 * i + 0] = upper[3 * i + 0].max(spheres.x[i] + spheres.r[i]);
+                upper[3 * i + 1] = upper[3 * i + 1].max(spheres.y[i] + spheres.r[i]);
+                upper[3 * i + 2] = upper[3 * i + 2].max(spheres.z[i] + spheres.r[i]);
+            }
+        }
+
+        std::vector<LinkReach> reach(Robot::n_links);
+        std::vector<std::vector<std::size_t>> members(Robot::n_links);
+        for (auto i = 0U; i < n; ++i)
+        {
+            auto &link = reach[Robot::sphere_links[i]];
+            members[Robot::sphere_links[i]].emplace_back(i);
+            for (auto j = 0U; j < 3; ++j)
+            {
+                const auto lanes_lower = lower[3 * i + j].to_array();
+                const auto lanes_upper = upper[3 * i + j].to_array();
+                const auto l = -*std::max_element(lanes_lower.cbegin(), lanes_lower.cbegin() + rake);
+                const auto u = *std::max_element(lanes_upper.cbegin(), lanes_upper.cbegin() + rake);
+
+                link.lower[j] = std::min(link.lower[j], l);
+                link.upper[j] = std::max(link.upper[j], u);
+            }
+        }
+
+        // Seeds are kept in the unit cube, where the climb steps. Each extent is climbed from the best
+        // `n_climbs` seeds, as one climb may stop at a lesser local maximum.
+        const auto &instance = Instance<Robot>::current();
+        using Seed = std::pair<float, std::array<float, Robot::dimension>>;
+        std::vector<std::array<std::vector<Seed>, 6>> seeds(Robot::n_links);
+
+        for (std::size_t sample = 0; sample < n_seeds; sample += rake)
+        {
+            auto block = rng->template next_block<rake>();
+            Robot::template sphere_fk<rake>(block, spheres);
+            instance.template descale_configuration_block<rake>(block);
+
+            for (auto l = 0U; l < Robot::n_links; ++l)
+            {
+                for (auto k = 0U; k < 6; ++k)
+                {
+                    auto &best = seeds[l][k];
+                    const auto extent =
+                        link_extent<Robot, rake>(spheres, members[l], k / 2, (k % 2) ? 1.F : -1.F).to_array();
+                    for (auto i = 0U; i < rake; ++i)
+                    {
+                        if (best.size() == n_climbs and extent[i] <= best.back().first)
+                        {
+                            continue;
+                        }
+
+                        Seed seed;
+                        seed.first = extent[i];
+                        for (auto j = 0U; j < Robot::dimension; ++j)
+                        {
+                            seed.second[j] = block[j].to_array()[i];
+                        }
+
+                        if (best.size() == n_climbs)
+                        {
+                            best.pop_back();
+                        }
+
+                        best.insert(
+                            std::upper_bound(
+                                best.begin(),
+                                best.end(),
+                                seed,
+                                [](const auto &a, const auto &b) { return a.first > b.first; }),
+                            seed);
+                    }
+                }
+            }
+        }
+
+        for (auto l = 0U; l < Robot::n_links; ++l)
+        {
+            if (members[l].empty())
+            {
+                continue;
+            }
+
+            for (auto k = 0U; k < 6; ++k)
+            {
+                const auto axis = k / 2;
+                const auto sign = (k % 2) ? 1.F : -1.F;
+                for (const auto &seed : seeds[l][k])
+                {
+                    const auto extent = climb_link_extent<Robot, rake>(seed.second, members[l], axis, sign);
+                    if (k % 2)
+                    {
+                        reach[l].upper[axis] = std::max(reach[l].upper[axis], extent);
+                    }
+                    else
+                    {
+                        reach[l].lower[axis] = std::min(reach[l].lower[axis], -extent);
+                    }
+                }
+            }
+
+            for (auto j = 0U; j < 3; ++j)
+            {
+                reach[l].lower[j] -= margin;
+                reach[l].upper[j] += margin;
+            }
+        }
+
+        return reach;
+    }
+
+    // Whether the instance of a robot bound to the calling thread lies within the bounds that per-link
+    // subsets were compiled for
+    template <typename Robot>
+    inline auto within_compiled_bounds(const collision::CompiledLinks &compiled) -> bool
+    {
+        const auto &instance = Instance<Robot>::current();
+        const auto lows = instance.lows();
+        const auto highs = instance.highs();
+        for (auto i = 0U; i < Robot::dimension; ++i)
+        {
+            if (lows[i] < compiled.lows[i] or highs[i] > compiled.highs[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Builds the per-link primitive subsets of an environment, which keep the sorted order of the full
+    // environment. The reach must have been bounded under the instance of the robot that is current here,
+    // whose bounds the subsets are keyed on. Must be compiled again after primitives are added, as
+    // Environment::sort() drops them.
+    template <typename Robot>
+    inline void
+    compile_environment(collision::Environment<float> &environment, const std::vector<LinkReach> &reach)
+    {
+        const auto subset = [](const auto &primitives, auto &out, const LinkReach &link)
+        {
+            std::copy_if(
+                primitives.cbegin(),
+                primitives.cend(),
+                std::back_inserter(out),
+                [&link](const auto &p) { return link.reaches(p); });
+        };
+
+        auto compiled = std::make_shared<collision::CompiledLinks>();
+        compiled->links.resize(Robot::n_links);
+        for (auto i = 0U; i < Robot::n_links; ++i)
+        {
+            auto &link = compiled->links[i];
+            subset(environment.spheres, link.spheres, reach[i]);
+            subset(environment.capsules, link.capsules, reach[i]);
+            subset(environment.z_aligned_capsules, link.z_aligned_capsules, reach[i]);
+            subset(environment.cylinders, link.cylinders, reach[i]);
+            subset(environment.cuboids, link.cuboids, reach[i]);
+            subset(environment.z_aligned_cuboids, link.z_aligned_cuboids, reach[i]);
+        }
+
+        const auto &instance = Instance<Robot>::current();
+        const auto lows = instance.lows();
+        const auto highs = instance.highs();
+        compiled->robot = Robot::name;
+        compiled->lows.assign(lows.cbegin(), lows.cend());
+        compiled->highs.assign(highs.cbegin(), highs.cend());
+        compiled->within_bounds = &within_compiled_bounds<Robot>;
+        collision::CompiledLinks::register_check(Robot::name, &within_compiled_bounds<Robot>);
+
+        environment.links = std::move(compiled);
+    }
+
+    // Drops points of a pointcloud that no link can reach, before they are built into a CAPT
+    inline auto filter_reachable(
+        const std::vector<collision::Point> &pointcloud,
+        const std::vector<LinkReach> &reach,
+        float r_point) -> std::vector<collision::Point>
+    {
+        const auto rsq = r_point * r_point;
+
+        std::vector<collision::Point> filtered;
+        std::copy_if(
+            pointcloud.cbegin(),
+            pointcloud.cend(),
+            std::back_inserter(filtered),
+            [&reach, rsq](const auto &p)
+            {
+                return std::any_of(
+                    reach.cbegin(),
+                    reach.cend(),
+                    [&p, rsq](const auto &link) { return link.sql2(p) <= rsq; });
+            });
+
+        return filtered;
+    }
+}  // namespace vamp::robots
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/shapes.hh>
+#include <vamp/random/uniform.hh>
+#include <vamp/robots/instance.hh>
+#include <vamp/thread_pool.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::robots
+{
+    struct ReachabilitySettings
+    {
+        float voxel_size = 0.05F;
+        collision::Point workspace_min = {-1.5F, -1.5F, -0.5F};
+        collision::Point workspace_max = {1.5F, 1.5F, 2.F};
+        std::size_t n_samples = 1000000;
+        std::uint64_t seed = 0;
+        std::size_t n_threads = std::thread::hardware_concurrency();
+    };
+
+    // End-effector poses reached by valid configurations, binned by position into voxels. Each voxel counts
+    // the samples that reached it and keeps a mask of the directions its approach (z) axis was reached from.
+    struct ReachabilityMap
+    {
+        // Approach directions are binned on the faces of a cube, with 3 x 3 cells per face
+        static constexpr std::size_t n_directions = 54;
+
+        // Written at the head of map files, followed by the format version
+        static constexpr std::uint32_t file_magic = 0x50414D52;  // "RMAP"
+        static constexpr std::uint32_t file_version = 1;
+
+        ReachabilityMap() = default;
+
+        ReachabilityMap(const collision::Point &origin, const collision::Point &end, float voxel_size)
+          : origin(origin), voxel_size(voxel_size)
+        {
+            for (auto i = 0U; i < 3; ++i)
+            {
+                const auto extent = std::ceil((end[i] - origin[i]) / voxel_size);
+                dims[i] = static_cast<std::uint32_t>(std::max(extent, 1.F));
+            }
+
+            counts.resize(size());
+            directions.resize(size());
+        }
+
+        collision::Point origin = {0.F, 0.F, 0.F};
+        float voxel_size = 1.F;
+        std::array<std::uint32_t, 3> dims = {0, 0, 0};
+        std::vector<std::uint32_t> counts;
+        std::vector<std::uint64_t> directions;
+
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(dims[0]) * dims[1] * dims[2];
+        }
+
+        // Index of the voxel containing a point, or size() if the point is outside of the map
+        [[nodiscard]] inline auto index(const collision::Point &p) const noexcept -> std::size_t
+        {
+            std::size_t index = 0;
+            for (auto i = 0U; i < 3; ++i)
+            {
+                const auto c = std::floor((p[i] - origin[i]) / voxel_size);
+                if (not (c >= 0.F and c < static_cast<float>(dims[i])))
+                {
+                    return size();
+                }
+
+                index = index * dims[i] + static_cast<std::size_t>(c);
+            }
+
+            return index;
+        }
+
+        // Center of the voxel at an index
+        [[nodiscard]] inline auto center(std::size_t index) const noexcept -> collision::Point
+        {
+            collision::Point p;
+            for (auto i = 3U; i-- > 0;)
+            {
+                p[i] = origin[i] + (static_cast<float>(index % dims[i]) + 0.5F) * voxel_size;
+                index /= dims[i];
+            }
+
+            return p;
+        }
+
+        // Fraction of approach directions reached at a point, which is zero outside of the map
+        [[nodiscard]] inline auto reachability(const collision::Point &p) const noexcept -> float
+        {
+            const auto i = index(p);
+            if (i == size())
+            {
+                return 0.F;
+            }
+
+            return static_cast<float>(popcount(directions[i])) / static_cast<float>(n_directions);
+        }
+
+        // Cube-map bin of a direction: the face of its major axis, then a 3 x 3 cell on that face
+        inline static auto direction_bin(float x, float y, float z) noexcept -> std::uint32_t
+        {
+            const std::array<float, 3> d = {x, y, z};
+
+            auto axis = 0U;
+            for (auto i = 1U; i < 3; ++i)
+            {
+                if (std::abs(d[i]) > std::abs(d[axis]))
+                {
+                    axis = i;
+                }
+            }
+
+            const auto major = std::abs(d[axis]);
+            const auto cell = [major](float c)
+            { return std::min(static_cast<std::uint32_t>((c / major + 1.F) * 1.5F), 2U); };
+
+            const auto face = 2 * axis + static_cast<std::uint32_t>(d[axis] < 0.F);
+            return 9 * face + 3 * cell(d[(axis + 1) % 3]) + cell(d[(axis + 2) % 3]);
+        }
+
+        inline auto save(const std::string &filename) const noexcept -> bool
+        {
+            std::ofstream file(filename, std::ios::binary);
+            if (not file)
+            {
+                return false;
+            }
+
+            write(file, file_magic);
+            write(file, file_version);
+            write(file, origin);
+            write(file, voxel_size);
+            write(file, dims);
+            file.write(reinterpret_cast<const char *>(counts.data()), sizeof(std::uint32_t) * size());
+            file.write(reinterpret_cast<const char *>(directions.data()), sizeof(std::uint64_t) * size());
+
+            return static_cast<bool>(file);
+        }
+
+        inline auto load(const std::string &filename) noexcept -> bool
+        {
+            std::ifstream file(filename, std::ios::binary);
+            if (not file)
+            {
+                return false;
+            }
+
+            std::uint32_t magic = 0, version = 0;
+            if (not read(file, magic) or not read(file, version) or magic != file_magic or
+                version != file_version or not read(file, origin) or not read(file, voxel_size) or
+                not read(file, dims))
+            {
+                return false;
+            }
+
+            counts.resize(size());
+            directions.resize(size());
+            return file.read(reinterpret_cast<char *>(counts.data()), sizeof(std::uint32_t) * size()) and
+                   file.read(reinterpret_cast<char *>(directions.data()), sizeof(std::uint64_t) * size());
+        }
+
+    private:
+        inline static auto popcount(std::uint64_t bits) noexcept -> std::uint32_t
+        {
+            std::uint32_t n = 0;
+            for (; bits != 0; bits &= bits - 1)
+            {
+                ++n;
+            }
+
+            return n;
+        }
+
+        template <typename T>
+        inline static void write(std::ofstream &file, const T &value) noexcept
+        {
+            file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        inline static auto read(std::ifstream &file, T &value) noexcept -> bool
+        {
+            return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+        }
+    };
+
+    // Builds a reachability map from uniformly sampled configurations within the bounds of the current
+    // instance. Configurations are drawn a block at a time, one per lane, from random streams keyed by the
+    // block's chunk, so the map does not depend on the number of threads. Blocks are checked with fkcc, and
+    // only the lanes of blocks in collision are checked again one at a time.
+    template <typename Robot>
+    inline auto build_reachability_map(
+        const collision::Environment<float> &environment,
+        const ReachabilitySettings &settings) -> ReachabilityMap
+    {
+        static constexpr auto rake = FloatVectorWidth;
+        static constexpr std::size_t blocks_per_chunk = 1024;
+        using Block = typename Robot::template ConfigurationBlock<rake>;
+
+        const auto ev = collision::Environment<FloatVector<rake>>::template for_robot<Robot>(environment);
+        const auto &instance = Instance<Robot>::current();
+        const auto scale = instance.s_m.to_array();
+        const auto offset = instance.s_a.to_array();
+
+        ReachabilityMap map(settings.workspace_min, settings.workspace_max, settings.voxel_size);
+        std::vector<std::atomic<std::uint32_t>> counts(map.size());
+        std::vector<std::atomic<std::uint64_t>> directions(map.size());
+
+        const auto valid = [&ev](const Block &block)
+        {
+            return (ev.attachments) ? Robot::template fkcc_attach<rake>(ev, block) :
+                                      Robot::template fkcc<rake>(ev, block);
+        };
+
+        const auto n_blocks = (settings.n_samples + rake - 1) / rake;
+        const auto n_chunks = (n_blocks + blocks_per_chunk - 1) / blocks_per_chunk;
+        utils::parallel_for(
+            settings.n_threads,
+            n_chunks,
+            [&](std::size_t chunk)
+            {
+                const typename Instance<Robot>::Scope scope(instance);
+                rng::UniformStream rng(settings.seed + 1, chunk + 1);
+
+                const auto end = std::min(n_blocks, (chunk + 1) * blocks_per_chunk);
+                for (auto b = chunk * blocks_per_chunk; b < end; ++b)
+                {
+                    Block block;
+                    for (auto i = 0U; i < Robot::dimension; ++i)
+                    {
+                        block[i] = rng.next() * scale[i] + offset[i];
+                    }
+
+                    std::array<bool, rake> lanes;
+                    lanes.fill(true);
+                    if (not valid(block))
+                    {
+                        const auto array = block.to_array();
+                        for (auto j = 0U; j < rake; ++j)
+                        {
+                            Block lane;
+                            for (auto i = 0U; i < Robot::dimension; ++i)
+                            {
+                                lane[i] = FloatVector<rake>::fill(array[i * rake + j]);
+                            }
+
+                            lanes[j] = valid(lane);
+                        }
+                    }
+
+                    const auto pose = Robot::template eefk<rake>(block);
+                    const auto x = pose[0].to_array();
+                    const auto y = pose[1].to_array();
+                    const auto z = pose[2].to_array();
+                    const auto ax = pose[9].to_array();
+                    const auto ay = pose[10].to_array();
+                    const auto az = pose[11].to_array();
+
+                    const auto n_lanes = std::min<std::size_t>(rake, settings.n_samples - b * rake);
+                    for (auto j = 0U; j < n_lanes; ++j)
+                    {
+                        const auto index = map.index({x[j], y[j], z[j]});
+                        if (not lanes[j] or index == map.size())
+                        {
+                            continue;
+                        }
+
+                        counts[index].fetch_add(1, std::memory_order_relaxed);
+                        directions[index].fetch_or(
+                            std::uint64_t(1) << ReachabilityMap::direction_bin(ax[j], ay[j], az[j]),
+                            std::memory_order_relaxed);
+                    }
+                }
+            });
+
+        for (auto i = 0U; i < map.size(); ++i)
+        {
+            map.counts[i] = counts[i].load(std::memory_order_relaxed);
+            map.directions[i] = directions[i].load(std::memory_order_relaxed);
+        }
+
+        return map;
+    }
+}  // namespace vamp::robots
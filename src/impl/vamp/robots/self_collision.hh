@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <vamp/random/rng.hh>
+#include <vamp/vector.hh>
+
+namespace vamp::robots
+{
+    // Samples configurations rake at a time and computes, for every pair of robot spheres, the smallest
+    // signed distance between them seen over all samples. Row-major n_spheres x n_spheres, symmetric; the
+    // diagonal is left at infinity. Used by the generator tooling to find link pairs that never collide.
+    template <typename Robot, std::size_t rake>
+    inline auto sample_sphere_clearances(std::size_t n_samples, typename vamp::rng::RNG<Robot>::Ptr rng)
+        -> std::vector<float>
+    {
+        constexpr auto n = Robot::n_spheres;
+
+        // Tracked as maximum penetration depth so that the running extremum is a vector max
+        std::vector<FloatVector<rake>> penetration(
+            n * (n - 1) / 2, FloatVector<rake>::fill(-std::numeric_limits<float>::max()));
+
+        typename Robot::template Spheres<rake> spheres;
+
+        for (std::size_t sample = 0; sample < n_samples; sample += rake)
+        {
+            Robot::template sphere_fk<rake>(rng->template next_block<rake>(), spheres);
+
+            for (std::size_t a = 0, k = 0; a < n; ++a)
+            {
+                const auto ax = spheres.x[a];
+                const auto ay = spheres.y[a];
+                const auto az = spheres.z[a];
+                const auto ar = spheres.r[a];
+
+                for (auto b = a + 1; b < n; ++b, ++k)
+                {
+                    const auto dx = ax - spheres.x[b];
+                    const auto dy = ay - spheres.y[b];
+                    const auto dz = az - spheres.z[b];
+                    const auto distance = (dx * dx + dy * dy + dz * dz).sqrt();
+
+                    penetration[k] = penetration[k].max(ar + spheres.r[b] - distance);
+                }
+            }
+        }
+
+        std::vector<float> clearances(n * n, std::numeric_limits<float>::infinity());
+        for (std::size_t a = 0, k = 0; a < n; ++a)
+        {
+            for (auto b = a + 1; b < n; ++b, ++k)
+            {
+                const auto lanes = penetration[k].to_array();
+                const auto deepest = *std::max_element(lanes.cbegin(), lanes.cbegin() + rake);
+                clearances[a * n + b] = clearances[b * n + a] = -deepest;
+            }
+        }
+
+        return clearances;
+    }
+}  // namespace vamp::robots
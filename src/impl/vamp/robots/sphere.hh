@@ -1,26 +1,25 @@
 #pragma once
 
+#include <vamp/robots/instance.hh>
 #include <vamp/vector.hh>
 
 namespace vamp::robots
 {
-    namespace
-    {
-        // Pad and align vectors for easy loading.
-        alignas(FloatVectorAlignment) static std::array<float, FloatVectorWidth> lows{-10, -10, 0};
-        alignas(FloatVectorAlignment) static std::array<float, FloatVectorWidth> highs{10, 10, 5};
-        static float radius = 0.2;
-    }  // namespace
-
+    // A free-flying sphere. Its bounds and the inflation of its radius can be changed per solve by binding a
+    // robots::Instance; the setters below only change the defaults used when no instance is bound.
     struct Sphere
     {
         static constexpr auto name = "sphere";
         static constexpr auto dimension = 3;
         static constexpr auto n_spheres = 1;
+        static constexpr auto n_links = 1;
         static constexpr auto resolution = 32;
 
+        // Radius without inflation; see Instance::min_max_radii()
+        inline static float radius = 0.2;
         static constexpr float &min_radius = radius;
         static constexpr float &max_radius = radius;
+        static constexpr bool inflatable = true;
 
         using Configuration = FloatVector<dimension>;
         using ConfigurationArray = std::array<FloatT, dimension>;
@@ -34,6 +33,8 @@ namespace vamp::robots
         };
 
         static constexpr std::array<std::string_view, dimension> joint_names = {"x", "y", "z"};
+        static constexpr std::array<std::string_view, n_links> link_names = {"sphere"};
+        static constexpr std::array<std::size_t, n_spheres> sphere_links = {0};
         static constexpr char *end_effector = "";
 
         template <std::size_t rake>
@@ -45,6 +46,10 @@ namespace vamp::robots
             FloatVector<rake, 1> r;
         };
 
+        // Default bounds, as scale factors from the unit cube
+        alignas(Configuration::S::Alignment) static constexpr std::array<float, dimension> s_m{20, 20, 5};
+        alignas(Configuration::S::Alignment) static constexpr std::array<float, dimension> s_a{-10, -10, 0};
+
         inline static void set_radius(float new_radius) noexcept
         {
             radius = new_radius;
@@ -52,51 +57,48 @@ namespace vamp::robots
 
         inline static void set_lows(std::array<float, 3> new_lows) noexcept
         {
-            std::copy_n(new_lows.cbegin(), 3, lows.begin());
+            auto &defaults = Instance<Sphere>::defaults();
+            defaults = Instance<Sphere>(new_lows, defaults.highs(), defaults.inflation);
         }
 
         inline static void set_highs(std::array<float, 3> new_highs) noexcept
         {
-            std::copy_n(new_highs.cbegin(), 3, highs.begin());
+            auto &defaults = Instance<Sphere>::defaults();
+            defaults = Instance<Sphere>(defaults.lows(), new_highs, defaults.inflation);
         }
 
         inline static void scale_configuration(Configuration &q) noexcept
         {
-            Configuration clow(lows.data());
-            Configuration chigh(highs.data());
-
-            q = q * (chigh - clow) + clow;
+            Instance<Sphere>::current().scale_configuration(q);
         }
 
         inline static void descale_configuration(Configuration &q) noexcept
         {
-            Configuration clow(lows.data());
-            Configuration chigh(highs.data());
-
-            q = (q - clow) / (chigh - clow);
+            Instance<Sphere>::current().descale_configuration(q);
         }
 
         template <std::size_t rake>
         inline static void scale_configuration_block(ConfigurationBlock<rake> &q) noexcept
         {
-            q[0] = lows[0] + (q[0] * (highs[0] - lows[0]));
-            q[1] = lows[1] + (q[1] * (highs[1] - lows[1]));
-            q[2] = lows[2] + (q[2] * (highs[2] - lows[2]));
+            Instance<Sphere>::current().scale_configuration_block<rake>(q);
         }
 
         template <std::size_t rake>
         inline static void descale_configuration_block(ConfigurationBlock<rake> &q) noexcept
         {
-            q[0] = (q[0] - lows[0]) / (highs[0] - lows[0]);
-            q[1] = (q[1] - lows[1]) / (highs[1] - lows[1]);
-            q[2] = (q[2] - lows[2]) / (highs[2] - lows[2]);
+            Instance<Sphere>::current().descale_configuration_block<rake>(q);
         }
 
+        // Length of the diagonal of the current bounds
         inline static auto space_measure() noexcept -> float
         {
-            Configuration clow(lows.data());
-            Configuration chigh(highs.data());
-            return (chigh - clow).l2_norm();
+            return Instance<Sphere>::current().s_m.l2_norm();
+        }
+
+        // Radius of the sphere in the current instance
+        inline static auto current_radius() noexcept -> float
+        {
+            return radius + Instance<Sphere>::current().inflation;
         }
 
         template <std::size_t rake>
@@ -104,7 +106,7 @@ namespace vamp::robots
             const vamp::collision::Environment<FloatVector<rake>> &environment,
             const ConfigurationBlock<rake> &q) noexcept
         {
-            return not sphere_environment_in_collision(environment, q[0], q[1], q[2], radius);
+            return not sphere_environment_in_collision(environment, 0, q[0], q[1], q[2], current_radius());
         }
 
         using Debug = std::
@@ -118,7 +120,8 @@ namespace vamp::robots
             Debug output;
 
             output.first.emplace_back(
-                sphere_environment_get_collisions<decltype(q[0])>(environment, q[0], q[1], q[2], radius));
+                sphere_environment_get_collisions<decltype(q[0])>(
+                    environment, q[0], q[1], q[2], current_radius()));
 
             return output;
         }
@@ -128,7 +131,7 @@ namespace vamp::robots
             const vamp::collision::Environment<FloatVector<rake>> &environment,
             const ConfigurationBlock<rake> &q) noexcept
         {
-            return not sphere_environment_in_collision(environment, q[0], q[1], q[2], radius);
+            return not sphere_environment_in_collision(environment, 0, q[0], q[1], q[2], current_radius());
         }
 
         template <std::size_t rake>
@@ -137,7 +140,7 @@ namespace vamp::robots
             out.x[0] = q[0];
             out.y[0] = q[1];
             out.z[0] = q[2];
-            out.r[0] = radius;
+            out.r[0] = current_radius();
         }
 
         static auto eefk(const std::array<float, 3> &q) noexcept -> Eigen::Isometry3f
@@ -146,5 +149,14 @@ namespace vamp::robots
             tf.translation() = Eigen::Vector3f(q[0], q[1], q[2]);
             return tf;
         }
+
+        template <std::size_t rake>
+        inline static auto
+        eefk(const ConfigurationBlock<rake> &q) noexcept -> std::array<FloatVector<rake>, 12>
+        {
+            const auto zero = FloatVector<rake>::fill(0.F);
+            const auto one = FloatVector<rake>::fill(1.F);
+            return {q[0], q[1], q[2], one, zero, zero, zero, one, zero, zero, zero, one};
+        }
     };
 }  // namespace vamp::robots
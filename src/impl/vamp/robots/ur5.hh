@@ -13,6 +13,7 @@ namespace vamp::robots
         static constexpr char *name = "ur5";
         static constexpr std::size_t dimension = 6;
         static constexpr std::size_t n_spheres = 40;
+        static constexpr std::size_t n_links = 17;
         static constexpr float min_radius = 0.014999999664723873;
         static constexpr float max_radius = 0.07999999821186066;
         static constexpr std::size_t resolution = 32;
@@ -24,6 +25,27 @@ namespace vamp::robots
             "wrist_1_joint",
             "wrist_2_joint",
             "wrist_3_joint"};
+        static constexpr std::array<std::string_view, n_links> link_names = {
+            "robotiq_85_right_finger_link",
+            "robotiq_85_right_knuckle_link",
+            "robotiq_85_right_finger_tip_link",
+            "robotiq_85_right_inner_knuckle_link",
+            "robotiq_85_left_finger_link",
+            "robotiq_85_left_knuckle_link",
+            "robotiq_85_left_finger_tip_link",
+            "robotiq_85_left_inner_knuckle_link",
+            "robotiq_85_base_link",
+            "fts_robotside",
+            "wrist_3_link",
+            "wrist_2_link",
+            "wrist_1_link",
+            "forearm_link",
+            "upper_arm_link",
+            "shoulder_link",
+            "base_link"};
+        static constexpr std::array<std::size_t, n_spheres> sphere_links = {
+            16, 15, 14, 14, 14, 14, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 12, 12, 11, 11, 11, 10, 9, 8,
+            8, 7, 6, 6, 5, 4, 4, 4, 3, 2, 2, 1, 0, 0, 0};
         static constexpr char *end_effector = "robotiq_85_base_link";
 
         using Configuration = FloatVector<dimension>;
@@ -3595,19 +3617,19 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_finger_link
-            if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+            if (sphere_environment_in_collision(environment, 0, y[224], y[225], y[226], y[227]))
             {
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 0, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 0, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 0, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
@@ -3618,9 +3640,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_knuckle_link
-            if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+            if (sphere_environment_in_collision(environment, 1, y[220], y[221], y[222], y[223]))
             {
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 1, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
@@ -3631,14 +3653,14 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_finger_tip_link
-            if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+            if (sphere_environment_in_collision(environment, 2, y[216], y[217], y[218], y[219]))
             {
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 2, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 2, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
@@ -3649,9 +3671,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_inner_knuckle_link
-            if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+            if (sphere_environment_in_collision(environment, 3, y[212], y[213], y[214], y[215]))
             {
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 3, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
@@ -3662,19 +3684,19 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_finger_link
-            if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+            if (sphere_environment_in_collision(environment, 4, y[208], y[209], y[210], y[211]))
             {
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 4, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 4, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 4, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
@@ -3685,9 +3707,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_knuckle_link
-            if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+            if (sphere_environment_in_collision(environment, 5, y[204], y[205], y[206], y[207]))
             {
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 5, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
@@ -3698,14 +3720,14 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_finger_tip_link
-            if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+            if (sphere_environment_in_collision(environment, 6, y[200], y[201], y[202], y[203]))
             {
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 6, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 6, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
@@ -3716,9 +3738,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_inner_knuckle_link
-            if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+            if (sphere_environment_in_collision(environment, 7, y[196], y[197], y[198], y[199]))
             {
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 7, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
@@ -3729,14 +3751,14 @@ namespace vamp::robots
             //
 
             // robotiq_85_base_link
-            if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+            if (sphere_environment_in_collision(environment, 8, y[192], y[193], y[194], y[195]))
             {
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 8, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 8, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
@@ -3747,9 +3769,9 @@ namespace vamp::robots
             //
 
             // fts_robotside
-            if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+            if (sphere_environment_in_collision(environment, 9, y[188], y[189], y[190], y[191]))
             {
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 9, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
@@ -3760,9 +3782,9 @@ namespace vamp::robots
             //
 
             // wrist_3_link
-            if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+            if (sphere_environment_in_collision(environment, 10, y[184], y[185], y[186], y[187]))
             {
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 10, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
@@ -3773,19 +3795,19 @@ namespace vamp::robots
             //
 
             // wrist_2_link
-            if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+            if (sphere_environment_in_collision(environment, 11, y[180], y[181], y[182], y[183]))
             {
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 11, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 11, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 11, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
@@ -3796,19 +3818,19 @@ namespace vamp::robots
             //
 
             // wrist_1_link
-            if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+            if (sphere_environment_in_collision(environment, 12, y[176], y[177], y[178], y[179]))
             {
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 12, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 12, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 12, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
@@ -3819,49 +3841,49 @@ namespace vamp::robots
             //
 
             // forearm_link
-            if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+            if (sphere_environment_in_collision(environment, 13, y[172], y[173], y[174], y[175]))
             {
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 13, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 13, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 13, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 13, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 13, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 13, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 13, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 13, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 13, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
@@ -3872,29 +3894,29 @@ namespace vamp::robots
             //
 
             // upper_arm_link
-            if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+            if (sphere_environment_in_collision(environment, 14, y[168], y[169], y[170], y[171]))
             {
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 14, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 14, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 14, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 14, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 14, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
@@ -3905,9 +3927,9 @@ namespace vamp::robots
             //
 
             // shoulder_link
-            if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+            if (sphere_environment_in_collision(environment, 15, y[164], y[165], y[166], y[167]))
             {
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 15, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
@@ -3918,9 +3940,9 @@ namespace vamp::robots
             //
 
             // base_link
-            if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+            if (sphere_environment_in_collision(environment, 16, y[160], y[161], y[162], y[163]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 16, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
@@ -6899,19 +6921,19 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_finger_link
-            if (sphere_environment_in_collision(environment, y[224], y[225], y[226], y[227]))
+            if (sphere_environment_in_collision(environment, 0, y[224], y[225], y[226], y[227]))
             {
-                if (sphere_environment_in_collision(environment, y[148], y[149], y[150], y[151]))
+                if (sphere_environment_in_collision(environment, 0, y[148], y[149], y[150], y[151]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[152], y[153], y[154], y[155]))
+                if (sphere_environment_in_collision(environment, 0, y[152], y[153], y[154], y[155]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[156], y[157], y[158], y[159]))
+                if (sphere_environment_in_collision(environment, 0, y[156], y[157], y[158], y[159]))
                 {
                     return false;
                 }
@@ -6922,9 +6944,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_knuckle_link
-            if (sphere_environment_in_collision(environment, y[220], y[221], y[222], y[223]))
+            if (sphere_environment_in_collision(environment, 1, y[220], y[221], y[222], y[223]))
             {
-                if (sphere_environment_in_collision(environment, y[144], y[145], y[146], y[147]))
+                if (sphere_environment_in_collision(environment, 1, y[144], y[145], y[146], y[147]))
                 {
                     return false;
                 }
@@ -6935,14 +6957,14 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_finger_tip_link
-            if (sphere_environment_in_collision(environment, y[216], y[217], y[218], y[219]))
+            if (sphere_environment_in_collision(environment, 2, y[216], y[217], y[218], y[219]))
             {
-                if (sphere_environment_in_collision(environment, y[136], y[137], y[138], y[139]))
+                if (sphere_environment_in_collision(environment, 2, y[136], y[137], y[138], y[139]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[140], y[141], y[142], y[143]))
+                if (sphere_environment_in_collision(environment, 2, y[140], y[141], y[142], y[143]))
                 {
                     return false;
                 }
@@ -6953,9 +6975,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_right_inner_knuckle_link
-            if (sphere_environment_in_collision(environment, y[212], y[213], y[214], y[215]))
+            if (sphere_environment_in_collision(environment, 3, y[212], y[213], y[214], y[215]))
             {
-                if (sphere_environment_in_collision(environment, y[132], y[133], y[134], y[135]))
+                if (sphere_environment_in_collision(environment, 3, y[132], y[133], y[134], y[135]))
                 {
                     return false;
                 }
@@ -6966,19 +6988,19 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_finger_link
-            if (sphere_environment_in_collision(environment, y[208], y[209], y[210], y[211]))
+            if (sphere_environment_in_collision(environment, 4, y[208], y[209], y[210], y[211]))
             {
-                if (sphere_environment_in_collision(environment, y[120], y[121], y[122], y[123]))
+                if (sphere_environment_in_collision(environment, 4, y[120], y[121], y[122], y[123]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[124], y[125], y[126], y[127]))
+                if (sphere_environment_in_collision(environment, 4, y[124], y[125], y[126], y[127]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[128], y[129], y[130], y[131]))
+                if (sphere_environment_in_collision(environment, 4, y[128], y[129], y[130], y[131]))
                 {
                     return false;
                 }
@@ -6989,9 +7011,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_knuckle_link
-            if (sphere_environment_in_collision(environment, y[204], y[205], y[206], y[207]))
+            if (sphere_environment_in_collision(environment, 5, y[204], y[205], y[206], y[207]))
             {
-                if (sphere_environment_in_collision(environment, y[116], y[117], y[118], y[119]))
+                if (sphere_environment_in_collision(environment, 5, y[116], y[117], y[118], y[119]))
                 {
                     return false;
                 }
@@ -7002,14 +7024,14 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_finger_tip_link
-            if (sphere_environment_in_collision(environment, y[200], y[201], y[202], y[203]))
+            if (sphere_environment_in_collision(environment, 6, y[200], y[201], y[202], y[203]))
             {
-                if (sphere_environment_in_collision(environment, y[108], y[109], y[110], y[111]))
+                if (sphere_environment_in_collision(environment, 6, y[108], y[109], y[110], y[111]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[112], y[113], y[114], y[115]))
+                if (sphere_environment_in_collision(environment, 6, y[112], y[113], y[114], y[115]))
                 {
                     return false;
                 }
@@ -7020,9 +7042,9 @@ namespace vamp::robots
             //
 
             // robotiq_85_left_inner_knuckle_link
-            if (sphere_environment_in_collision(environment, y[196], y[197], y[198], y[199]))
+            if (sphere_environment_in_collision(environment, 7, y[196], y[197], y[198], y[199]))
             {
-                if (sphere_environment_in_collision(environment, y[104], y[105], y[106], y[107]))
+                if (sphere_environment_in_collision(environment, 7, y[104], y[105], y[106], y[107]))
                 {
                     return false;
                 }
@@ -7033,14 +7055,14 @@ namespace vamp::robots
             //
 
             // robotiq_85_base_link
-            if (sphere_environment_in_collision(environment, y[192], y[193], y[194], y[195]))
+            if (sphere_environment_in_collision(environment, 8, y[192], y[193], y[194], y[195]))
             {
-                if (sphere_environment_in_collision(environment, y[96], y[97], y[98], y[99]))
+                if (sphere_environment_in_collision(environment, 8, y[96], y[97], y[98], y[99]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[100], y[101], y[102], y[103]))
+                if (sphere_environment_in_collision(environment, 8, y[100], y[101], y[102], y[103]))
                 {
                     return false;
                 }
@@ -7051,9 +7073,9 @@ namespace vamp::robots
             //
 
             // fts_robotside
-            if (sphere_environment_in_collision(environment, y[188], y[189], y[190], y[191]))
+            if (sphere_environment_in_collision(environment, 9, y[188], y[189], y[190], y[191]))
             {
-                if (sphere_environment_in_collision(environment, y[92], y[93], y[94], y[95]))
+                if (sphere_environment_in_collision(environment, 9, y[92], y[93], y[94], y[95]))
                 {
                     return false;
                 }
@@ -7064,9 +7086,9 @@ namespace vamp::robots
             //
 
             // wrist_3_link
-            if (sphere_environment_in_collision(environment, y[184], y[185], y[186], y[187]))
+            if (sphere_environment_in_collision(environment, 10, y[184], y[185], y[186], y[187]))
             {
-                if (sphere_environment_in_collision(environment, y[88], y[89], y[90], y[91]))
+                if (sphere_environment_in_collision(environment, 10, y[88], y[89], y[90], y[91]))
                 {
                     return false;
                 }
@@ -7077,19 +7099,19 @@ namespace vamp::robots
             //
 
             // wrist_2_link
-            if (sphere_environment_in_collision(environment, y[180], y[181], y[182], y[183]))
+            if (sphere_environment_in_collision(environment, 11, y[180], y[181], y[182], y[183]))
             {
-                if (sphere_environment_in_collision(environment, y[76], y[77], y[78], y[79]))
+                if (sphere_environment_in_collision(environment, 11, y[76], y[77], y[78], y[79]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[80], y[81], y[82], y[83]))
+                if (sphere_environment_in_collision(environment, 11, y[80], y[81], y[82], y[83]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[84], y[85], y[86], y[87]))
+                if (sphere_environment_in_collision(environment, 11, y[84], y[85], y[86], y[87]))
                 {
                     return false;
                 }
@@ -7100,19 +7122,19 @@ namespace vamp::robots
             //
 
             // wrist_1_link
-            if (sphere_environment_in_collision(environment, y[176], y[177], y[178], y[179]))
+            if (sphere_environment_in_collision(environment, 12, y[176], y[177], y[178], y[179]))
             {
-                if (sphere_environment_in_collision(environment, y[64], y[65], y[66], y[67]))
+                if (sphere_environment_in_collision(environment, 12, y[64], y[65], y[66], y[67]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[68], y[69], y[70], y[71]))
+                if (sphere_environment_in_collision(environment, 12, y[68], y[69], y[70], y[71]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[72], y[73], y[74], y[75]))
+                if (sphere_environment_in_collision(environment, 12, y[72], y[73], y[74], y[75]))
                 {
                     return false;
                 }
@@ -7123,49 +7145,49 @@ namespace vamp::robots
             //
 
             // forearm_link
-            if (sphere_environment_in_collision(environment, y[172], y[173], y[174], y[175]))
+            if (sphere_environment_in_collision(environment, 13, y[172], y[173], y[174], y[175]))
             {
-                if (sphere_environment_in_collision(environment, y[28], y[29], y[30], y[31]))
+                if (sphere_environment_in_collision(environment, 13, y[28], y[29], y[30], y[31]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[32], y[33], y[34], y[35]))
+                if (sphere_environment_in_collision(environment, 13, y[32], y[33], y[34], y[35]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[36], y[37], y[38], y[39]))
+                if (sphere_environment_in_collision(environment, 13, y[36], y[37], y[38], y[39]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[40], y[41], y[42], y[43]))
+                if (sphere_environment_in_collision(environment, 13, y[40], y[41], y[42], y[43]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[44], y[45], y[46], y[47]))
+                if (sphere_environment_in_collision(environment, 13, y[44], y[45], y[46], y[47]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[48], y[49], y[50], y[51]))
+                if (sphere_environment_in_collision(environment, 13, y[48], y[49], y[50], y[51]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[52], y[53], y[54], y[55]))
+                if (sphere_environment_in_collision(environment, 13, y[52], y[53], y[54], y[55]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[56], y[57], y[58], y[59]))
+                if (sphere_environment_in_collision(environment, 13, y[56], y[57], y[58], y[59]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[60], y[61], y[62], y[63]))
+                if (sphere_environment_in_collision(environment, 13, y[60], y[61], y[62], y[63]))
                 {
                     return false;
                 }
@@ -7176,29 +7198,29 @@ namespace vamp::robots
             //
 
             // upper_arm_link
-            if (sphere_environment_in_collision(environment, y[168], y[169], y[170], y[171]))
+            if (sphere_environment_in_collision(environment, 14, y[168], y[169], y[170], y[171]))
             {
-                if (sphere_environment_in_collision(environment, y[8], y[9], y[10], y[11]))
+                if (sphere_environment_in_collision(environment, 14, y[8], y[9], y[10], y[11]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[12], y[13], y[14], y[15]))
+                if (sphere_environment_in_collision(environment, 14, y[12], y[13], y[14], y[15]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[16], y[17], y[18], y[19]))
+                if (sphere_environment_in_collision(environment, 14, y[16], y[17], y[18], y[19]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[20], y[21], y[22], y[23]))
+                if (sphere_environment_in_collision(environment, 14, y[20], y[21], y[22], y[23]))
                 {
                     return false;
                 }
 
-                if (sphere_environment_in_collision(environment, y[24], y[25], y[26], y[27]))
+                if (sphere_environment_in_collision(environment, 14, y[24], y[25], y[26], y[27]))
                 {
                     return false;
                 }
@@ -7209,9 +7231,9 @@ namespace vamp::robots
             //
 
             // shoulder_link
-            if (sphere_environment_in_collision(environment, y[164], y[165], y[166], y[167]))
+            if (sphere_environment_in_collision(environment, 15, y[164], y[165], y[166], y[167]))
             {
-                if (sphere_environment_in_collision(environment, y[4], y[5], y[6], y[7]))
+                if (sphere_environment_in_collision(environment, 15, y[4], y[5], y[6], y[7]))
                 {
                     return false;
                 }
@@ -7222,9 +7244,9 @@ namespace vamp::robots
             //
 
             // base_link
-            if (sphere_environment_in_collision(environment, y[160], y[161], y[162], y[163]))
+            if (sphere_environment_in_collision(environment, 16, y[160], y[161], y[162], y[163]))
             {
-                if (sphere_environment_in_collision(environment, y[0], y[1], y[2], y[3]))
+                if (sphere_environment_in_collision(environment, 16, y[0], y[1], y[2], y[3]))
                 {
                     return false;
                 }
@@ -9942,8 +9964,23 @@ namespace vamp::robots
 
         inline static auto eefk(const std::array<float, 6> &x) noexcept -> Eigen::Isometry3f
         {
-            std::array<float, 28> v;
-            std::array<float, 12> y;
+            return to_isometry(eefk_transform<float>(x).data());
+        }
+
+        // End-effector poses of a block of configurations, one per lane, as the translation followed by the
+        // column-major rotation
+        template <std::size_t rake>
+        inline static auto
+        eefk(const ConfigurationBlock<rake> &x) noexcept -> std::array<FloatVector<rake>, 12>
+        {
+            return eefk_transform<FloatVector<rake>>(x);
+        }
+
+        template <typename DataT, typename InputT>
+        inline static auto eefk_transform(const InputT &x) noexcept -> std::array<DataT, 12>
+        {
+            std::array<DataT, 28> v;
+            std::array<DataT, 12> y;
 
             v[0] = sin(x[0]);
             v[1] = -v[0];
@@ -10019,7 +10056,7 @@ namespace vamp::robots
             y[10] = -0.000796324663347988 * v[19] + 0.999999365865199 * v[2] + 0.000796326710733264 * v[21];
             y[11] = -0.000796324663347988 * v[25] + 0.999999365865199 * v[9] + 0.000796326710733264 * v[16];
 
-            return to_isometry(y.data());
+            return y;
         }
     };
 }  // namespace vamp::robots
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace vamp::utils
+{
+    // Fixed-size pool of worker threads that run jobs in the order they were submitted.
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(std::size_t n_threads = std::thread::hardware_concurrency())
+        {
+            n_threads = std::max(n_threads, std::size_t(1));
+            workers.reserve(n_threads);
+            for (auto i = 0U; i < n_threads; ++i)
+            {
+                workers.emplace_back([this]() { run(); });
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        auto operator=(const ThreadPool &) -> ThreadPool & = delete;
+
+        // Finishes all submitted jobs before joining
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+
+            available.notify_all();
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        inline void submit(std::function<void()> job)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                jobs.emplace_back(std::move(job));
+            }
+
+            available.notify_one();
+        }
+
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t
+        {
+            return workers.size();
+        }
+
+    private:
+        inline void run()
+        {
+            while (true)
+            {
+                std::function<void()> job;
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    available.wait(lock, [this]() { return stopping or not jobs.empty(); });
+
+                    if (jobs.empty())
+                    {
+                        return;
+                    }
+
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                }
+
+                job();
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::deque<std::function<void()>> jobs;
+        std::mutex mutex;
+        std::condition_variable available;
+        bool stopping = false;
+    };
+
+    // Runs `f(i)` for every `i < n` on up to `n_threads` threads, including the calling thread
+    template <typename F>
+    inline void parallel_for(std::size_t n_threads, std::size_t n, const F &f)
+    {
+        const auto n_workers = std::min(n_threads, n);
+        if (n_workers <= 1)
+        {
+            for (auto i = 0U; i < n; ++i)
+            {
+                f(i);
+            }
+
+            return;
+        }
+
+        std::atomic<std::size_t> next = 0;
+        const auto work = [&]()
+        {
+            for (auto i = next++; i < n; i = next++)
+            {
+                f(i);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(n_workers - 1);
+        for (auto i = 1U; i < n_workers; ++i)
+        {
+            workers.emplace_back(work);
+        }
+
+        work();
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Runs `f(i)` for every `i < n` on up to `n_threads` threads, including the calling thread. Each thread
+    // starts with an equal share of the indices, which it works through from the front. Threads that run out
+    // steal the back half of the remaining share of another thread, so jobs of very uneven lengths (e.g.,
+    // planning queries) stay balanced without contending on one shared counter.
+    template <typename F>
+    inline void parallel_for_stealing(std::size_t n_threads, std::size_t n, const F &f)
+    {
+        const auto n_workers = std::max(std::min(n_threads, n), std::size_t(1));
+
+        struct Share
+        {
+            std::mutex mutex;
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        std::vector<Share> shares(n_workers);
+        for (auto w = 0U; w < n_workers; ++w)
+        {
+            shares[w].begin = n * w / n_workers;
+            shares[w].end = n * (w + 1) / n_workers;
+        }
+
+        const auto work = [&](std::size_t w)
+        {
+            auto &own = shares[w];
+            while (true)
+            {
+                std::size_t i = n;
+                {
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    if (own.begin < own.end)
+                    {
+                        i = own.begin++;
+                    }
+                }
+
+                if (i != n)
+                {
+                    f(i);
+                    continue;
+                }
+
+                // Stolen indices are owned by this thread once taken, so no other thread can miss them
+                std::size_t begin = n, end = n;
+                for (auto k = 1U; k < n_workers and begin == n; ++k)
+                {
+                    auto &victim = shares[(w + k) % n_workers];
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    if (victim.begin < victim.end)
+                    {
+                        begin = victim.begin + (victim.end - victim.begin) / 2;
+                        end = victim.end;
+                        victim.end = begin;
+                    }
+                }
+
+                if (begin == n)
+                {
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock(own.mutex);
+                own.begin = begin;
+                own.end = end;
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(n_workers - 1);
+        for (auto w = 1U; w < n_workers; ++w)
+        {
+            workers.emplace_back(work, w);
+        }
+
+        work(0);
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+}  // namespace vamp::utils
@@ -9,15 +9,32 @@ __all__ = [
     "Sphere",
     "Cuboid",
     "Cylinder",
+    "LinkReach",
+    "ReachabilitySettings",
+    "ReachabilityMap",
     "RRTCSettings",
     "PRMSettings",
     "PRMNeighborParams",
     "FCITSettings",
     "FCITNeighborParams",
     "AORRTCSettings",
+    "ExperienceSettings",
+    "RepairSettings",
+    "IKSettings",
+    "CartesianSettings",
+    "OrientationConstraint",
+    "ConstrainedRRTCSettings",
     "SimplifySettings",
     "SimplifyRoutine",
     "filter_pointcloud",
+    "filter_reachable",
+    "sample_surfaces",
+    "PointCloudAccumulator",
+    "share_environment",
+    "attach_environment",
+    "unlink_environment",
+    "TiledHeightField",
+    "write_tiled_heightfield",
     ]
 
 from pathlib import Path
@@ -34,15 +51,32 @@ from ._core import Cuboid as Cuboid
 from ._core import Cylinder as Cylinder
 from ._core import Attachment as Attachment
 from ._core import Environment as Environment
+from ._core import LinkReach as LinkReach
+from ._core import ReachabilitySettings as ReachabilitySettings
+from ._core import ReachabilityMap as ReachabilityMap
 from ._core import PRMNeighborParams as PRMNeighborParams
 from ._core import PRMSettings as PRMSettings
 from ._core import RRTCSettings as RRTCSettings
 from ._core import FCITNeighborParams as FCITNeighborParams
 from ._core import FCITSettings as FCITSettings
 from ._core import AORRTCSettings as AORRTCSettings
+from ._core import ExperienceSettings as ExperienceSettings
+from ._core import RepairSettings as RepairSettings
+from ._core import IKSettings as IKSettings
+from ._core import CartesianSettings as CartesianSettings
+from ._core import OrientationConstraint as OrientationConstraint
+from ._core import ConstrainedRRTCSettings as ConstrainedRRTCSettings
 from ._core import SimplifyRoutine as SimplifyRoutine
 from ._core import SimplifySettings as SimplifySettings
 from ._core import filter_pointcloud as filter_pointcloud
+from ._core import filter_reachable as filter_reachable
+from ._core import sample_surfaces as sample_surfaces
+from ._core import PointCloudAccumulator as PointCloudAccumulator
+from ._core import share_environment as share_environment
+from ._core import attach_environment as attach_environment
+from ._core import unlink_environment as unlink_environment
+from ._core import TiledHeightField as TiledHeightField
+from ._core import write_tiled_heightfield as write_tiled_heightfield
 
 robots = _core.robots()
 
@@ -67,6 +101,22 @@ def png_to_heightfield(
 
 
 def configure_robot_and_planner_with_kwargs(robot_name: str, planner_name: str, **kwargs):
+    # Settings from a file written by `scripts/autotune.py`, which explicit keywords override
+    settings_file = kwargs.pop("settings_file", None)
+    if settings_file is not None:
+        import json
+
+        with open(settings_file, 'r') as f:
+            tuned = json.load(f)
+
+        if tuned["robot"] != robot_name or tuned["planner"] != planner_name:
+            raise ValueError(
+                f"Settings in {settings_file} are for {tuned['planner']} on {tuned['robot']}, "
+                f"not {planner_name} on {robot_name}!"
+                )
+
+        kwargs = {**tuned["settings"], **kwargs}
+
     robot_module = getattr(_core, robot_name)
     try:
         planner_func = getattr(robot_module, planner_name)
@@ -102,6 +152,14 @@ def configure_robot_and_planner_with_kwargs(robot_name: str, planner_name: str,
             print(f"Setting planner - {k}: {v}")
             setattr(plan_settings, k, v)
 
+    # PRM and FCIT neighbor parameters
+    for k, v in kwargs.items():
+        if k.startswith("neighbor_"):
+            sk = k.replace("neighbor_", "")
+            if hasattr(plan_settings, "neighbor_params") and hasattr(plan_settings.neighbor_params, sk):
+                print(f"Setting planner - neighbor - {sk}: {v}")
+                setattr(plan_settings.neighbor_params, sk, v)
+
     # AORRTC Internal
     for k, v in kwargs.items():
         if "rrtc_" in k:
@@ -0,0 +1,26 @@
+import asyncio
+from typing import Any
+
+
+async def wait(future: Any) -> Any:
+    """Waits for a future returned by one of the `*_async` planning functions without blocking the event loop.
+
+    Futures are also awaitable directly, e.g., `result = await vamp.panda.rrtc_async(...)`.
+    """
+    if not future.done():
+        loop = asyncio.get_running_loop()
+        ready = loop.create_future()
+
+        def on_ready():
+            if not ready.done():
+                ready.set_result(None)
+
+        # The descriptor stays readable once signalled, so completion before the reader is added is not missed
+        fd = future.fileno()
+        loop.add_reader(fd, on_ready)
+        try:
+            await ready
+        finally:
+            loop.remove_reader(fd)
+
+    return future.result()
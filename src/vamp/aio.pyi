@@ -0,0 +1,12 @@
+"""
+This type stub file was generated by pyright.
+"""
+from typing import Any
+
+async def wait(future: Any) -> Any:
+    """Waits for a future returned by one of the `*_async` planning functions without blocking the event loop.
+
+    Futures are also awaitable directly, e.g., `result = await vamp.panda.rrtc_async(...)`.
+    """
+    ...
+
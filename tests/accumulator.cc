@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Geometry>
+
+#include <vamp/collision/accumulator.hh>
+
+using vamp::collision::AccumulatorSettings;
+using vamp::collision::Point;
+using vamp::collision::PointCloudAccumulator;
+
+static constexpr float voxel_size = 0.1F;
+static constexpr std::size_t n_side = 3;
+
+static std::size_t failures = 0;
+
+static auto fail(const std::string &message)
+{
+    std::cerr << message << std::endl;
+    ++failures;
+}
+
+template <typename F>
+static auto throws(F &&f) -> bool
+{
+    try
+    {
+        f();
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+// One point near the center of each voxel of a cube of voxels, offset by less than half a voxel
+static auto cube(float jitter) -> std::vector<Point>
+{
+    std::vector<Point> points;
+    for (auto i = 0U; i < n_side; ++i)
+    {
+        for (auto j = 0U; j < n_side; ++j)
+        {
+            for (auto k = 0U; k < n_side; ++k)
+            {
+                points.push_back(
+                    {(i + 0.5F) * voxel_size + jitter,
+                     (j + 0.5F) * voxel_size + jitter,
+                     (k + 0.5F) * voxel_size + jitter});
+            }
+        }
+    }
+
+    return points;
+}
+
+static auto sorted(std::vector<Point> points) -> std::vector<Point>
+{
+    std::sort(points.begin(), points.end());
+    return points;
+}
+
+// Checks that the accumulator keeps one point per voxel, only re-emits when voxels appear or expire, expires
+// each sensor's voxels by when they were last observed, and does not depend on the number of threads.
+auto main(int, char **) -> int
+{
+    AccumulatorSettings settings;
+    settings.voxel_size = voxel_size;
+    settings.decay = 1.;
+
+    PointCloudAccumulator accumulator(settings);
+    const auto a = accumulator.add_sensor();
+    const auto b = accumulator.add_sensor(Eigen::Isometry3f(Eigen::Translation3f(1.F, 0.F, 0.F)));
+
+    const auto points = cube(0.F);
+    const auto n_voxels = points.size();
+
+    // Points in the same voxel as one already seen in the same frame are merged, and points outside of the
+    // workspace or not finite are dropped
+    auto frame = points;
+    frame.push_back({0.01F, 0.01F, 0.01F});
+    frame.push_back({100.F, 0.F, 0.F});
+    frame.push_back({std::numeric_limits<float>::quiet_NaN(), 0.F, 0.F});
+
+    accumulator.ingest({a, b}, std::vector<std::vector<Point>>{frame, points}, 0.);
+    const auto first = accumulator.points(0.);
+    if (first.size() != 2 * n_voxels or accumulator.size() != 2 * n_voxels)
+    {
+        fail("Expected one point per voxel, got " + std::to_string(first.size()));
+    }
+
+    const auto version = accumulator.version();
+
+    // Observing the same voxels again only refreshes them, and keeps the points they were first seen with
+    accumulator.ingest(a, cube(0.02F), 0.5);
+    if (accumulator.points(0.5) != first or accumulator.version() != version)
+    {
+        fail("Re-observing occupied voxels re-emitted points");
+    }
+
+    // The voxels of sensor b were last seen at 0, and decay past 1
+    const auto decayed = accumulator.points(1.2);
+    if (accumulator.version() == version or sorted(decayed) != sorted(points))
+    {
+        fail("Expired voxels were not removed, or unexpired voxels changed");
+    }
+
+    if (not accumulator.points(2.).empty() or accumulator.size() != 0)
+    {
+        fail("All voxels should have expired");
+    }
+
+    // The points kept for each voxel do not depend on how the frames are spread over threads
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> coordinate(-1.F, 1.F);
+    std::vector<std::vector<Point>> clouds(8, std::vector<Point>(5000));
+    for (auto &cloud : clouds)
+    {
+        for (auto &point : cloud)
+        {
+            point = {coordinate(generator), coordinate(generator), coordinate(generator)};
+        }
+    }
+
+    std::vector<std::vector<Point>> results;
+    for (const std::size_t n_threads : {1, 3, 8})
+    {
+        settings.n_threads = n_threads;
+        PointCloudAccumulator threaded(settings);
+        std::vector<std::size_t> sensors;
+        for (auto i = 0U; i < clouds.size(); ++i)
+        {
+            sensors.push_back(threaded.add_sensor());
+        }
+
+        threaded.ingest(sensors, clouds, 0.);
+        results.push_back(sorted(threaded.points(0.)));
+    }
+
+    if (results[0] != results[1] or results[0] != results[2])
+    {
+        fail("Accumulated points depend on the number of threads");
+    }
+
+    settings.voxel_size = 0.F;
+    if (not throws([&settings]() { PointCloudAccumulator invalid(settings); }))
+    {
+        fail("A zero voxel size was accepted");
+    }
+
+    if (not throws([&accumulator, &points]() { accumulator.ingest(7, points, 3.); }))
+    {
+        fail("An unknown sensor was accepted");
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/factory.hh>
+#include <vamp/planning/batch.hh>
+#include <vamp/planning/rrtc.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/random/stream.hh>
+#include <vamp/robots/panda.hh>
+#include <vamp/vector.hh>
+
+using Robot = vamp::robots::Panda;
+static constexpr std::size_t rake = vamp::FloatVectorWidth;
+using EnvironmentVector = vamp::collision::Environment<vamp::FloatVector<rake>>;
+using Planner = vamp::planning::RRTC<Robot, rake, Robot::resolution>;
+
+static constexpr std::size_t n_obstacles = 40;
+static constexpr std::size_t n_queries = 24;
+static constexpr std::uint64_t seed = 7;
+
+static std::size_t failures = 0;
+
+static auto fail(const std::string &message)
+{
+    std::cerr << message << std::endl;
+    ++failures;
+}
+
+static auto same_path(const vamp::planning::Path<Robot> &a, const vamp::planning::Path<Robot> &b) -> bool
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    for (auto i = 0U; i < a.size(); ++i)
+    {
+        if (a[i].to_array() != b[i].to_array())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static auto same_result(
+    const vamp::planning::PlanningResult<Robot> &a,
+    const vamp::planning::PlanningResult<Robot> &b) -> bool
+{
+    return a.iterations == b.iterations and a.size == b.size and same_path(a.path, b.path);
+}
+
+// Solves a batch of queries with different numbers of threads, and checks that every query gets the same
+// plan and simplification each time, which are those of solving it alone with its own random stream.
+auto main(int, char **) -> int
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> coordinate(-1.F, 1.F);
+    std::uniform_real_distribution<float> height(0.F, 1.5F);
+    std::uniform_real_distribution<float> size(0.05F, 0.15F);
+
+    vamp::collision::Environment<float> environment;
+    for (auto i = 0U; i < n_obstacles; ++i)
+    {
+        environment.spheres.emplace_back(vamp::collision::factory::sphere::flat(
+            coordinate(generator), coordinate(generator), height(generator), size(generator)));
+    }
+
+    environment.sort();
+    const EnvironmentVector environment_v(environment);
+
+    vamp::rng::Stream<Robot> rng(1, 2);
+    const auto valid = [&]()
+    {
+        typename Robot::Configuration configuration;
+        do
+        {
+            configuration = rng.next();
+        } while (not vamp::planning::validate_motion<Robot, rake, 1>(
+            configuration, configuration, environment_v));
+
+        return configuration;
+    };
+
+    std::vector<vamp::planning::BatchQuery<Robot>> queries;
+    for (auto i = 0U; i < n_queries; ++i)
+    {
+        const auto start = valid();
+        queries.push_back({start, {valid(), valid()}});
+    }
+
+    // Unsolvable queries run until these limits, which are deterministic as well
+    vamp::planning::RRTCSettings settings;
+    settings.max_iterations = 5000;
+    settings.max_samples = 5000;
+
+    const vamp::planning::SimplifySettings simplify_settings;
+
+    std::vector<std::vector<vamp::planning::BatchResult<Robot>>> batches;
+    for (const std::size_t n_threads : {1, 3, 8})
+    {
+        batches.emplace_back(vamp::planning::solve_batch<Robot, rake, Robot::resolution, Planner>(
+            queries, environment_v, settings, simplify_settings, seed, n_threads));
+    }
+
+    std::size_t solved = 0;
+    for (auto i = 0U; i < n_queries; ++i)
+    {
+        typename vamp::rng::RNG<Robot>::Ptr query_rng =
+            std::make_shared<vamp::rng::Stream<Robot>>(seed + 1, i + 1);
+        const auto alone =
+            Planner::solve(queries[i].start, queries[i].goals, environment_v, settings, query_rng);
+
+        for (const auto &batch : batches)
+        {
+            const auto &result = batch[i];
+            if (not same_result(result.plan, alone) or result.simplified.has_value() == alone.path.empty())
+            {
+                fail("Query " + std::to_string(i) + " depends on the number of threads");
+                break;
+            }
+
+            if (result.simplified and not same_result(*result.simplified, *batches.front()[i].simplified))
+            {
+                fail("Simplification of query " + std::to_string(i) + " depends on the number of threads");
+                break;
+            }
+        }
+
+        solved += not alone.path.empty();
+    }
+
+    if (solved == 0)
+    {
+        fail("No query was solved");
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <vamp/collision/capt.hh>
+#include <vamp/vector.hh>
+
+using FVector = vamp::FloatVector<>;
+static constexpr std::size_t width = vamp::FloatVectorWidth;
+
+static constexpr std::size_t n_points = 20000;
+static constexpr std::size_t n_queries = 160000;
+static constexpr float r_min = 0.01;
+static constexpr float r_max = 0.1;
+static constexpr float r_point = 0.02;
+
+// Checks CAPT queries against brute force for spheres that just touch, or just miss, a point. Queries are
+// placed within (r + r_point) of a point in any direction, with radii up to r_max, so they reach cells
+// across splits only through the affordance of their points, and lie just outside the top-level AABB
+// around the points on the boundary of the cloud.
+auto main(int, char **) -> int
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> coordinate(-1.F, 1.F);
+    std::uniform_real_distribution<float> radius(r_min, r_max);
+    std::normal_distribution<float> normal;
+
+    std::vector<vamp::collision::Point> points(n_points);
+    for (auto &point : points)
+    {
+        point = {coordinate(generator), coordinate(generator), coordinate(generator)};
+    }
+
+    const vamp::collision::CAPT capt(points, r_min, r_max, r_point);
+
+    const auto brute_force = [&points](const vamp::collision::Point &center, float r)
+    {
+        const auto r2 = (r + r_point) * (r + r_point);
+        for (const auto &point : points)
+        {
+            const auto dx = point[0] - center[0];
+            const auto dy = point[1] - center[1];
+            const auto dz = point[2] - center[2];
+            if (dx * dx + dy * dy + dz * dz <= r2)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    std::size_t failures = 0;
+    std::array<std::array<float, width>, 4> lanes;
+    std::array<bool, width> expected;
+    for (auto i = 0U; i < n_queries; ++i)
+    {
+        const auto &point = points[generator() % n_points];
+        const auto r = (i % 2 == 0) ? r_max : radius(generator);
+
+        // Half of the queries touch the point, half miss it by a hair
+        const auto scale = (r + r_point) * ((i % 4 < 2) ? 0.999F : 1.001F);
+        std::array<float, 3> direction = {normal(generator), normal(generator), normal(generator)};
+        const auto norm = std::sqrt(
+            direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+
+        const vamp::collision::Point center = {
+            point[0] + direction[0] / norm * scale,
+            point[1] + direction[1] / norm * scale,
+            point[2] + direction[2] / norm * scale};
+
+        const auto truth = brute_force(center, r);
+        if (capt.collides(center, r) != truth)
+        {
+            ++failures;
+        }
+
+        const auto lane = i % width;
+        lanes[0][lane] = center[0];
+        lanes[1][lane] = center[1];
+        lanes[2][lane] = center[2];
+        lanes[3][lane] = r;
+        expected[lane] = truth;
+
+        if (lane == width - 1)
+        {
+            bool any = false;
+            for (const auto e : expected)
+            {
+                any = any or e;
+            }
+
+            const std::array<FVector, 3> centers = {FVector(lanes[0]), FVector(lanes[1]), FVector(lanes[2])};
+            if (capt.collides_simd(centers, FVector(lanes[3])) != any)
+            {
+                ++failures;
+            }
+        }
+    }
+
+    if (failures != 0)
+    {
+        std::cerr << failures << " CAPT queries disagree with brute force" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
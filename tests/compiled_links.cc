@@ -0,0 +1,146 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/factory.hh>
+#include <vamp/planning/rrtc.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/random/stream.hh>
+#include <vamp/robots/panda.hh>
+#include <vamp/robots/reachability.hh>
+#include <vamp/robots/sphere.hh>
+#include <vamp/robots/ur5.hh>
+#include <vamp/vector.hh>
+
+static constexpr std::size_t rake = vamp::FloatVectorWidth;
+using EnvironmentVector = vamp::collision::Environment<vamp::FloatVector<rake>>;
+
+static constexpr std::size_t n_obstacles = 60;
+static constexpr std::size_t n_blocks = 2000;
+static constexpr std::size_t n_plans = 10;
+
+static std::size_t failures = 0;
+
+static auto fail(const std::string &message)
+{
+    std::cerr << message << std::endl;
+    ++failures;
+}
+
+// Checks robots in an environment compiled for the Panda. Only the Panda may use the per-link subsets; every
+// other robot must check the whole environment, and so agree with an environment that was never compiled.
+// The UR5 has more links than the Panda, so culling it with the Panda's subsets would read out of bounds.
+template <typename Robot>
+auto check(
+    const vamp::collision::Environment<float> &plain,
+    const vamp::collision::Environment<float> &compiled)
+{
+    const auto full = EnvironmentVector::for_robot<Robot>(plain);
+    const auto converted = EnvironmentVector::for_robot<Robot>(compiled);
+
+    const bool is_panda = std::string(Robot::name) == vamp::robots::Panda::name;
+    if ((converted.links != nullptr) != is_panda)
+    {
+        fail(std::string(Robot::name) + " kept the wrong per-link subsets");
+    }
+
+    // Plain conversions never keep subsets, as they do not know the robot that will check them
+    if (EnvironmentVector(compiled).links)
+    {
+        fail("Conversion without a robot kept per-link subsets");
+    }
+
+    vamp::rng::Stream<Robot> rng(1, 2);
+    for (auto i = 0U; i < n_blocks; ++i)
+    {
+        std::array<std::array<float, rake>, Robot::dimension> lanes;
+        for (auto k = 0U; k < rake; ++k)
+        {
+            const auto configuration = rng.next().to_array();
+            for (auto j = 0U; j < Robot::dimension; ++j)
+            {
+                lanes[j][k] = configuration[j];
+            }
+        }
+
+        typename Robot::template ConfigurationBlock<rake> block;
+        for (auto j = 0U; j < Robot::dimension; ++j)
+        {
+            block[j] = vamp::FloatVector<rake>(lanes[j]);
+        }
+
+        auto copy = block;
+        if (Robot::template fkcc<rake>(full, block) != Robot::template fkcc<rake>(converted, copy))
+        {
+            fail(std::string(Robot::name) + " disagrees between compiled and plain environments");
+            break;
+        }
+    }
+
+    // Plans in the compiled environment must be valid in the whole environment
+    typename vamp::rng::RNG<Robot>::Ptr planner_rng = std::make_shared<vamp::rng::Stream<Robot>>(3, 4);
+    vamp::planning::RRTCSettings settings;
+    for (auto i = 0U; i < n_plans; ++i)
+    {
+        typename Robot::Configuration start, goal;
+        do
+        {
+            start = planner_rng->next();
+        } while (not vamp::planning::validate_motion<Robot, rake, 1>(start, start, full));
+
+        do
+        {
+            goal = planner_rng->next();
+        } while (not vamp::planning::validate_motion<Robot, rake, 1>(goal, goal, full));
+
+        auto result = vamp::planning::RRTC<Robot, rake, Robot::resolution>::solve(
+            start, goal, converted, settings, planner_rng);
+        if (not result.path.empty() and not result.path.template validate<rake>(full))
+        {
+            fail(std::string(Robot::name) + " planned through an obstacle in a compiled environment");
+        }
+    }
+}
+
+auto main(int, char **) -> int
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> coordinate(-1.5F, 1.5F);
+    std::uniform_real_distribution<float> height(0.F, 2.F);
+    std::uniform_real_distribution<float> size(0.05F, 0.15F);
+
+    vamp::collision::Environment<float> plain;
+    for (auto i = 0U; i < n_obstacles; ++i)
+    {
+        const auto x = coordinate(generator);
+        const auto y = coordinate(generator);
+        const auto z = height(generator);
+        if (i % 2 == 0)
+        {
+            plain.spheres.emplace_back(vamp::collision::factory::sphere::flat(x, y, z, size(generator)));
+        }
+        else
+        {
+            plain.cuboids.emplace_back(vamp::collision::factory::cuboid::flat(
+                x, y, z, 0.F, 0.F, 0.F, size(generator), size(generator), size(generator)));
+        }
+    }
+
+    plain.sort();
+
+    auto compiled = plain;
+    vamp::rng::RNG<vamp::robots::Panda>::Ptr rng =
+        std::make_shared<vamp::rng::Stream<vamp::robots::Panda>>(0, 0);
+    vamp::robots::compile_environment<vamp::robots::Panda>(
+        compiled, vamp::robots::sample_link_reach<vamp::robots::Panda, rake>(10000, 0.05F, rng));
+
+    check<vamp::robots::Panda>(plain, compiled);
+    check<vamp::robots::UR5>(plain, compiled);
+    check<vamp::robots::Sphere>(plain, compiled);
+
+    return (failures == 0) ? 0 : 1;
+}
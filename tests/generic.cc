@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <Eigen/Geometry>
+
+#include <vamp/collision/attachments.hh>
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/factory.hh>
+#include <vamp/robots/generic.hh>
+#include <vamp/robots/panda.hh>
+#include <vamp/vector.hh>
+
+using Panda = vamp::robots::Panda;
+using Generic = vamp::robots::Generic<Panda::dimension, Panda::n_spheres, 13>;
+
+static constexpr std::size_t rake = vamp::FloatVectorWidth;
+using EnvironmentVector = vamp::collision::Environment<vamp::FloatVector<rake>>;
+
+static constexpr std::size_t n_obstacles = 20;
+static constexpr std::size_t n_blocks = 5000;
+
+// Largest difference between the generated kinematics and those composed from the model, which is below
+// 5e-7 in practice, as they round differently
+static constexpr float tolerance = 1e-6F;
+
+static std::size_t failures = 0;
+
+static auto fail(const std::string &message)
+{
+    std::cerr << message << std::endl;
+    ++failures;
+}
+
+template <std::size_t n>
+static auto difference(const vamp::FloatVector<rake, n> &a, const vamp::FloatVector<rake, n> &b) -> float
+{
+    const auto d = (a - b).abs().to_array();
+    return *std::max_element(d.cbegin(), d.cend());
+}
+
+// Loads the Panda's model file (given as the first argument) into the generic robot, and checks that its
+// joint limits, sphere and end-effector poses, and collision checks match those of the generated Panda.
+auto main(int argc, char **argv) -> int
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <panda.model>" << std::endl;
+        return 1;
+    }
+
+    Generic::load(argv[1]);
+
+    const auto &generated = vamp::robots::Instance<Panda>::current();
+    const auto &loaded = vamp::robots::Instance<Generic>::current();
+    for (auto i = 0U; i < Panda::dimension; ++i)
+    {
+        if (std::abs(generated.lows()[i] - loaded.lows()[i]) > 1e-6F or
+            std::abs(generated.highs()[i] - loaded.highs()[i]) > 1e-6F)
+        {
+            fail("Joint limits of joint " + std::to_string(i) + " differ");
+        }
+    }
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> coordinate(-0.8F, 0.8F);
+    std::uniform_real_distribution<float> height(0.F, 1.2F);
+    std::uniform_real_distribution<float> size(0.05F, 0.15F);
+
+    // Obstacles are kept clear of the base, which would otherwise collide in every configuration
+    vamp::collision::Environment<float> environment;
+    while (environment.spheres.size() < n_obstacles)
+    {
+        const auto x = coordinate(generator);
+        const auto y = coordinate(generator);
+        if (std::hypot(x, y) > 0.3F)
+        {
+            environment.spheres.emplace_back(
+                vamp::collision::factory::sphere::flat(x, y, height(generator), size(generator)));
+        }
+    }
+
+    environment.sort();
+
+    // An object held 10 cm past the end effector
+    vamp::collision::Attachment<float> attachment(Eigen::Isometry3f(Eigen::Translation3f(0.F, 0.F, 0.1F)));
+    attachment.spheres.emplace_back(0.F, 0.F, 0.F, 0.05F);
+
+    auto attached = environment;
+    attached.attachments.emplace(attachment);
+
+    const EnvironmentVector environment_v(environment);
+    const EnvironmentVector attached_v(attached);
+    const EnvironmentVector empty_v(vamp::collision::Environment<float>{});
+
+    std::uniform_real_distribution<float> unit(0.F, 1.F);
+    float sphere_error = 0.F;
+    float pose_error = 0.F;
+    std::array<std::size_t, 2> outcomes = {0, 0};
+    for (auto i = 0U; i < n_blocks; ++i)
+    {
+        std::array<std::array<float, rake>, Panda::dimension> lanes;
+        for (auto &lane : lanes)
+        {
+            std::generate(lane.begin(), lane.end(), [&]() { return unit(generator); });
+        }
+
+        Panda::ConfigurationBlock<rake> block;
+        for (auto j = 0U; j < Panda::dimension; ++j)
+        {
+            block[j] = vamp::FloatVector<rake>(lanes[j]);
+        }
+
+        generated.scale_configuration_block<rake>(block);
+
+        Panda::Spheres<rake> panda_spheres;
+        Generic::Spheres<rake> generic_spheres;
+        Panda::sphere_fk<rake>(block, panda_spheres);
+        Generic::sphere_fk<rake>(block, generic_spheres);
+        sphere_error = std::max(
+            {sphere_error,
+             difference(panda_spheres.x, generic_spheres.x),
+             difference(panda_spheres.y, generic_spheres.y),
+             difference(panda_spheres.z, generic_spheres.z),
+             difference(panda_spheres.r, generic_spheres.r)});
+
+        const auto panda_pose = Panda::eefk<rake>(block);
+        const auto generic_pose = Generic::eefk<rake>(block);
+        for (auto k = 0U; k < panda_pose.size(); ++k)
+        {
+            pose_error = std::max(pose_error, difference(panda_pose[k], generic_pose[k]));
+        }
+
+        // Blocks of different configurations are nearly always invalid somewhere, so each block is also
+        // checked as one configuration in every lane
+        Panda::ConfigurationBlock<rake> single;
+        for (auto j = 0U; j < Panda::dimension; ++j)
+        {
+            single[j] = vamp::FloatVector<rake>::fill(block[j].to_array()[0]);
+        }
+
+        const auto agree = [&](const Panda::ConfigurationBlock<rake> &q)
+        {
+            return Panda::fkcc<rake>(environment_v, q) == Generic::fkcc<rake>(environment_v, q) and
+                   Panda::fkcc<rake>(empty_v, q) == Generic::fkcc<rake>(empty_v, q) and
+                   Panda::fkcc_attach<rake>(attached_v, q) == Generic::fkcc_attach<rake>(attached_v, q);
+        };
+
+        if (not agree(block) or not agree(single))
+        {
+            fail("Collision checks of the generic robot disagree with the generated Panda");
+            break;
+        }
+
+        ++outcomes[Panda::fkcc<rake>(environment_v, single)];
+    }
+
+    if (sphere_error > tolerance or pose_error > tolerance)
+    {
+        fail(
+            "Generic robot differs from the generated Panda by " + std::to_string(sphere_error) +
+            " in its spheres and " + std::to_string(pose_error) + " in its end-effector pose");
+    }
+
+    if (outcomes[0] == 0 or outcomes[1] == 0)
+    {
+        fail("Collision checks did not exercise both outcomes");
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <vamp/planning/nn.hh>
+#include <vamp/planning/rpforest.hh>
+#include <vamp/utils.hh>
+#include <vamp/vector.hh>
+
+static constexpr std::size_t dimension = 7;
+static constexpr std::size_t n_states = 20000;
+static constexpr std::size_t n_queries = 2000;
+static constexpr std::size_t k = 10;
+static constexpr float radius = 0.8F;
+
+// Fraction of queries whose nearest state must be found exactly, which is about 0.75 for the default trees
+// and leaf size
+static constexpr float min_recall = 0.6F;
+
+// Identical states inserted to check that leaves which cannot be split do not stall insertion
+static constexpr std::size_t n_duplicates = 50000;
+
+using State = vamp::FloatVector<dimension>;
+using Node = vamp::planning::NNNode<dimension>;
+using Key = vamp::planning::NNFloatArray<dimension>;
+
+static std::size_t failures = 0;
+
+static auto fail(const std::string &message)
+{
+    std::cerr << message << std::endl;
+    ++failures;
+}
+
+struct Buffer
+{
+    explicit Buffer(std::size_t n)
+      : data(
+            vamp::utils::vector_alloc<float, vamp::FloatVectorAlignment, vamp::FloatVectorWidth>(
+                n * State::num_scalars_rounded),
+            &free)
+    {
+    }
+
+    inline auto operator[](std::size_t index) const noexcept -> float *
+    {
+        return data.get() + index * State::num_scalars_rounded;
+    }
+
+    std::unique_ptr<float, decltype(&free)> data;
+};
+
+// Compares the nearest neighbors found by a random projection forest against the exact ones of NN, and
+// checks that neighbors within a radius are exact distances, closest first, and within the radius.
+auto main(int, char **) -> int
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> coordinate(-1.F, 1.F);
+
+    const auto sample = [&](float *state)
+    {
+        std::array<float, dimension> values;
+        for (auto &value : values)
+        {
+            value = coordinate(generator);
+        }
+
+        State(values).to_array(state);
+    };
+
+    Buffer states(n_states);
+    Buffer queries(n_queries);
+
+    vamp::planning::NN<dimension> exact;
+    vamp::planning::RPForest<dimension> forest;
+    for (auto i = 0U; i < n_states; ++i)
+    {
+        sample(states[i]);
+        exact.insert(Node{i, {states[i]}});
+        forest.insert(Node{i, {states[i]}});
+    }
+
+    if (forest.size() != n_states)
+    {
+        fail("Forest lost states");
+    }
+
+    std::size_t found = 0;
+    std::vector<std::pair<Node, float>> neighbors;
+    for (auto i = 0U; i < n_queries; ++i)
+    {
+        sample(queries[i]);
+        const Key key{queries[i]};
+
+        const auto truth = exact.nearest(key);
+        const auto approximate = forest.nearest(key);
+        if (not approximate or approximate->second < truth->second)
+        {
+            fail("Forest found a state closer than the nearest");
+            break;
+        }
+
+        found += approximate->first.index == truth->first.index;
+
+        forest.nearest(neighbors, key, k, radius);
+        for (auto j = 0U; j < neighbors.size(); ++j)
+        {
+            const auto &[node, distance] = neighbors[j];
+            const auto actual = (node.as_vector() - State(queries[i])).l2_norm();
+            if (std::abs(distance - actual) > 1e-5F or distance > radius or
+                (j > 0 and distance < neighbors[j - 1].second) or j >= k)
+            {
+                fail("Forest returned wrong neighbors within a radius");
+                break;
+            }
+        }
+    }
+
+    const auto recall = static_cast<float>(found) / n_queries;
+    if (recall < min_recall)
+    {
+        fail("Forest recall " + std::to_string(recall) + " is below " + std::to_string(min_recall));
+    }
+
+    // Every state is the same, so no leaf can be split
+    Buffer duplicate(1);
+    sample(duplicate[0]);
+
+    vamp::planning::RPForest<dimension> duplicates;
+    for (auto i = 0U; i < n_duplicates; ++i)
+    {
+        duplicates.insert(Node{i, {duplicate[0]}});
+    }
+
+    const auto nearest = duplicates.nearest(Key{duplicate[0]});
+    if (not nearest or nearest->second != 0.F)
+    {
+        fail("Forest of duplicates did not find them");
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
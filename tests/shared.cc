@@ -0,0 +1,192 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <vamp/collision/capt.hh>
+#include <vamp/collision/environment.hh>
+#include <vamp/collision/factory.hh>
+#include <vamp/collision/shared.hh>
+#include <vamp/planning/validate.hh>
+#include <vamp/random/stream.hh>
+#include <vamp/robots/panda.hh>
+#include <vamp/vector.hh>
+
+using Robot = vamp::robots::Panda;
+static constexpr std::size_t rake = vamp::FloatVectorWidth;
+using EnvironmentVector = vamp::collision::Environment<vamp::FloatVector<rake>>;
+
+static constexpr std::size_t n_obstacles = 30;
+static constexpr std::size_t n_points = 5000;
+static constexpr std::size_t n_cells = 64;
+static constexpr std::size_t n_configurations = 10000;
+
+static std::size_t failures = 0;
+
+static auto fail(const std::string &message)
+{
+    std::cerr << message << std::endl;
+    ++failures;
+}
+
+template <typename F>
+static auto throws(F &&f) -> bool
+{
+    try
+    {
+        f();
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+// Round trips an environment of every kind of geometry through shared memory, and checks that the attached
+// copy matches the original, primitive for primitive and collision check for collision check.
+auto main(int, char **) -> int
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> coordinate(-1.F, 1.F);
+    std::uniform_real_distribution<float> height(0.F, 1.5F);
+    std::uniform_real_distribution<float> angle(-3.F, 3.F);
+    std::uniform_real_distribution<float> size(0.05F, 0.15F);
+
+    vamp::collision::Environment<float> environment;
+    for (auto i = 0U; i < n_obstacles; ++i)
+    {
+        const auto x = coordinate(generator);
+        const auto y = coordinate(generator);
+        const auto z = height(generator);
+        const auto r = size(generator);
+        switch (i % 3)
+        {
+            case 0:
+                environment.spheres.emplace_back(vamp::collision::factory::sphere::flat(x, y, z, r));
+                break;
+            case 1:
+                environment.capsules.emplace_back(vamp::collision::factory::capsule::center::flat(
+                    x, y, z, angle(generator), angle(generator), angle(generator), r, 2 * r));
+                break;
+            default:
+                environment.cuboids.emplace_back(vamp::collision::factory::cuboid::flat(
+                    x, y, z, angle(generator), angle(generator), angle(generator), r, r, r));
+                break;
+        }
+    }
+
+    std::vector<float> heights(n_cells * n_cells);
+    for (auto &h : heights)
+    {
+        h = 0.1F * height(generator);
+    }
+
+    environment.heightfields.emplace_back(vamp::collision::factory::heightfield::flat(
+        0.F, 0.F, -0.3F, 4.F, 4.F, 1.F, n_cells, n_cells, heights));
+
+    std::vector<vamp::collision::Point> points(n_points);
+    for (auto &point : points)
+    {
+        point = {0.5F + 0.1F * coordinate(generator), 0.1F * coordinate(generator), height(generator)};
+    }
+
+    environment.pointclouds.emplace_back(points, 0.01F, 0.2F, 0.01F);
+    environment.sort();
+
+    const auto name = "/vamp_test_shared_" + std::to_string(getpid());
+    vamp::collision::shared::create(environment, name);
+
+    if (not throws([&name, &environment]() { vamp::collision::shared::create(environment, name); }))
+    {
+        fail("Creating a shared environment over an existing one did not fail");
+    }
+
+    const auto attached = vamp::collision::shared::attach(name);
+
+    // Attached environments stay valid once the name is gone
+    vamp::collision::shared::unlink(name);
+
+    if (attached.spheres.size() != environment.spheres.size() or
+        attached.capsules.size() != environment.capsules.size() or
+        attached.cuboids.size() != environment.cuboids.size() or
+        attached.heightfields.size() != 1 or attached.pointclouds.size() != 1)
+    {
+        fail("Attached environment has different primitives");
+        return 1;
+    }
+
+    for (auto i = 0U; i < environment.spheres.size(); ++i)
+    {
+        const auto &a = attached.spheres[i];
+        const auto &b = environment.spheres[i];
+        if (a.x != b.x or a.y != b.y or a.z != b.z or a.r != b.r)
+        {
+            fail("Attached sphere differs");
+        }
+    }
+
+    const auto &field = attached.heightfields.front();
+    if (field.data.data() == environment.heightfields.front().data.data() or
+        not std::equal(heights.cbegin(), heights.cend(), field.data.data()))
+    {
+        fail("Attached heightfield is not a copy of the original");
+    }
+
+    const auto original_v = EnvironmentVector(environment);
+    const auto attached_v = EnvironmentVector(attached);
+
+    vamp::rng::Stream<Robot> rng(1, 2);
+    std::array<std::size_t, 2> outcomes = {0, 0};
+    for (auto i = 0U; i < n_configurations; ++i)
+    {
+        const auto configuration = rng.next();
+        const auto valid =
+            vamp::planning::validate_motion<Robot, rake, 1>(configuration, configuration, original_v);
+        const auto attached_valid =
+            vamp::planning::validate_motion<Robot, rake, 1>(configuration, configuration, attached_v);
+        if (valid != attached_valid)
+        {
+            fail("Attached environment disagrees with the original");
+            break;
+        }
+
+        ++outcomes[valid];
+    }
+
+    if (outcomes[0] == 0 or outcomes[1] == 0)
+    {
+        fail(
+            "Collision checks did not exercise both outcomes: " + std::to_string(outcomes[0]) + " invalid, " +
+            std::to_string(outcomes[1]) + " valid");
+    }
+
+    if (not throws([&name]() { vamp::collision::shared::attach(name); }))
+    {
+        fail("Attaching an unlinked shared environment did not fail");
+    }
+
+    // A segment whose magic has not been published yet must not be read
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 or ftruncate(fd, 4096) != 0)
+    {
+        fail("Failed to create an unpublished segment");
+    }
+    else if (not throws([&name]() { vamp::collision::shared::attach(name); }))
+    {
+        fail("Attaching an unpublished shared environment did not fail");
+    }
+
+    close(fd);
+    shm_unlink(name.c_str());
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <vamp/collision/sphere_heightfield.hh>
+#include <vamp/collision/tiled_heightfield.hh>
+#include <vamp/vector.hh>
+
+using vamp::collision::TiledHeightField;
+
+static constexpr std::size_t rake = vamp::FloatVectorWidth;
+
+// Neither side is a multiple of the tile size, so the far tiles are padded
+static constexpr std::size_t width = 150;
+static constexpr std::size_t height = 90;
+static constexpr std::size_t tile_size = 32;
+static constexpr float cell_size = 0.5F;
+static constexpr std::size_t n_blocks = 10000;
+
+static std::size_t failures = 0;
+
+static auto fail(const std::string &message)
+{
+    std::cerr << message << std::endl;
+    ++failures;
+}
+
+static auto read_file(const std::string &filename) -> std::vector<char>
+{
+    std::ifstream file(filename, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+static auto write_file(const std::string &filename, const std::vector<char> &bytes)
+{
+    std::ofstream file(filename, std::ios::binary);
+    file.write(bytes.data(), bytes.size());
+}
+
+// Opens a corrupted copy of a tiled heightfield, which must be rejected with an exception
+static auto expect_rejected(
+    const std::string &filename,
+    const std::vector<char> &bytes,
+    const std::string &corruption)
+{
+    write_file(filename, bytes);
+    try
+    {
+        TiledHeightField::open(filename);
+        fail("Opened a tiled heightfield with " + corruption);
+    }
+    catch (const std::runtime_error &)
+    {
+    }
+}
+
+template <typename T>
+static auto with_field(std::vector<char> bytes, std::size_t offset, T value) -> std::vector<char>
+{
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+    return bytes;
+}
+
+// Writes terrain to a tiled heightfield and checks that spheres collide with the tiles exactly where they
+// collide with the terrain, and that corrupted or truncated files are rejected instead of read.
+auto main(int, char **) -> int
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> terrain(-1.F, 1.F);
+
+    std::vector<float> heights(width * height);
+    for (auto y = 0U; y < height; ++y)
+    {
+        for (auto x = 0U; x < width; ++x)
+        {
+            heights[y * width + x] = std::sin(0.1F * x) * std::cos(0.07F * y) + 0.2F * terrain(generator);
+        }
+    }
+
+    const vamp::collision::Point origin = {-10.F, 5.F, 1.F};
+    const auto filename = "/tmp/vamp_test_tiled_heightfield_" + std::to_string(getpid());
+    TiledHeightField::write(filename, heights.data(), width, height, origin, cell_size, tile_size);
+
+    {
+        const auto field = TiledHeightField::open(filename);
+        if (field.width != width or field.height != height or field.tile_size != tile_size or
+            field.tiles_x != 5 or field.tiles_y != 3)
+        {
+            fail("Tiled heightfield has the wrong dimensions");
+        }
+
+        // Spheres over and beyond the terrain, from well above to well below it
+        std::uniform_real_distribution<float> x(origin[0] - 5.F, origin[0] + width * cell_size + 5.F);
+        std::uniform_real_distribution<float> y(origin[1] - 5.F, origin[1] + height * cell_size + 5.F);
+        std::uniform_real_distribution<float> z(origin[2] - 2.F, origin[2] + 2.F);
+        std::uniform_real_distribution<float> r(0.F, 0.5F);
+
+        std::array<std::size_t, 2> outcomes = {0, 0};
+        for (auto i = 0U; i < n_blocks; ++i)
+        {
+            std::array<float, rake> xs, ys, zs, rs;
+            for (auto k = 0U; k < rake; ++k)
+            {
+                xs[k] = x(generator);
+                ys[k] = y(generator);
+                zs[k] = z(generator);
+                rs[k] = r(generator);
+            }
+
+            const auto distances = vamp::collision::sphere_tiled_heightfield(
+                                       field,
+                                       vamp::FloatVector<rake>(xs),
+                                       vamp::FloatVector<rake>(ys),
+                                       vamp::FloatVector<rake>(zs),
+                                       vamp::FloatVector<rake>(rs))
+                                       .to_array();
+
+            for (auto k = 0U; k < rake; ++k)
+            {
+                // Spheres beyond the edges are checked against the nearest edge cell
+                const auto cx = std::clamp(
+                    std::floor((xs[k] - origin[0]) / cell_size), 0.F, static_cast<float>(width - 1));
+                const auto cy = std::clamp(
+                    std::floor((ys[k] - origin[1]) / cell_size), 0.F, static_cast<float>(height - 1));
+                const auto terrain_height =
+                    heights[static_cast<std::size_t>(cy) * width + static_cast<std::size_t>(cx)];
+
+                const auto expected = zs[k] - rs[k] - origin[2] < terrain_height;
+                if ((distances[k] < 0.F) != expected)
+                {
+                    fail("Tiled heightfield disagrees with the terrain");
+                    break;
+                }
+
+                ++outcomes[expected];
+            }
+        }
+
+        if (outcomes[0] == 0 or outcomes[1] == 0)
+        {
+            fail("Spheres did not exercise both outcomes");
+        }
+    }
+
+    using Header = TiledHeightField::Header;
+    const auto bytes = read_file(filename);
+    const auto corrupted = filename + "_corrupted";
+
+    expect_rejected(corrupted, with_field(bytes, offsetof(Header, magic), 'X'), "a wrong magic");
+    expect_rejected(
+        corrupted,
+        with_field(bytes, offsetof(Header, version), TiledHeightField::file_version + 1),
+        "an unknown version");
+    expect_rejected(
+        corrupted,
+        with_field(bytes, offsetof(Header, tile_size), std::uint32_t{0}),
+        "a tile size of zero");
+    expect_rejected(
+        corrupted,
+        with_field(bytes, offsetof(Header, tile_size), std::uint32_t{24}),
+        "a tile size that is not a power of two");
+    expect_rejected(
+        corrupted, with_field(bytes, offsetof(Header, width), std::uint64_t{0}), "a width of zero");
+    expect_rejected(
+        corrupted,
+        with_field(bytes, offsetof(Header, height), std::uint64_t{1} << 40),
+        "a height whose size overflows");
+    expect_rejected(
+        corrupted,
+        with_field(bytes, offsetof(Header, width), std::uint64_t{width + tile_size}),
+        "more tiles than it stores");
+    expect_rejected(
+        corrupted,
+        with_field(bytes, offsetof(Header, data_offset), std::uint64_t{sizeof(Header)}),
+        "heights that overlap the tile bounds");
+    expect_rejected(
+        corrupted,
+        with_field(bytes, offsetof(Header, data_offset), std::uint64_t{bytes.size() + 4096}),
+        "heights past the end of the file");
+    expect_rejected(
+        corrupted,
+        std::vector<char>(bytes.cbegin(), bytes.cbegin() + bytes.size() - sizeof(float)),
+        "a truncated last tile");
+    expect_rejected(
+        corrupted,
+        std::vector<char>(bytes.cbegin(), bytes.cbegin() + sizeof(Header) - 1),
+        "a truncated header");
+
+    std::remove(corrupted.c_str());
+    std::remove(filename.c_str());
+
+    try
+    {
+        TiledHeightField::open(filename);
+        fail("Opened a missing tiled heightfield");
+    }
+    catch (const std::runtime_error &)
+    {
+    }
+
+    return (failures == 0) ? 0 : 1;
+}